@@ -0,0 +1,218 @@
+#pragma once
+# ifndef AVL_ALGO_HPP
+# define AVL_ALGO_HPP
+
+# include "Rb_algo.hpp"
+
+namespace ft {
+
+	// AVL policy for Rb_tree: sibling subtrees differ in height by at most
+	// one, so the tree is at most 1.44 log2(n) deep against 2 log2(n) for
+	// red-black, for more rotations on updates. The balance factor lives
+	// in the color field, see Color.
+	struct	Avl_balance {
+		typedef true_type	balanced;
+
+		template <typename Val>
+		static void	access(Rb_Node<Val>*, Rb_Node<Val>&) {}
+
+		template <typename Val>
+		static void	insert(bool insert_left, Rb_Node<Val>* x, Rb_Node<Val>* p, Rb_Node<Val>& header) {
+			x->parent = p;
+			x->left = 0;
+			x->right = 0;
+			x->color = _black;
+# ifdef FT_RB_THREADED
+			if (insert_left)
+				rb_link_before(x, p);
+			else
+				rb_link_before(x, p->next);
+# endif
+			if (insert_left) {
+				p->left = x;
+				if (p == &header) {
+					header.parent = x;
+					header.right = x;
+				}
+				else if (p == header.left)
+					header.left = x;
+			}
+			else {
+				p->right = x;
+				if (p == header.right)
+					header.right = x;
+			}
+			_grown(x, header);
+		}
+
+		// Unlinks z as rebalance_for_erase() does, the successor taking
+		// over the balance factor of z, then retraces from where a subtree
+		// lost a level.
+		template <typename Val>
+		static Rb_Node<Val>*	erase(Rb_Node<Val>* const z, Rb_Node<Val>& header) {
+			Rb_Node<Val>*&	root = header.parent;
+			Rb_Node<Val>*	y = z;
+			Rb_Node<Val>*	x = 0;
+			Rb_Node<Val>*	xparent = 0;
+			bool			left;
+
+# ifdef FT_RB_THREADED
+			rb_unlink(z);
+# endif
+			if (y->left == 0)
+				x = y->right;
+			else if (y->right == 0)
+				x = y->left;
+			else {
+				y = Rb_Node<Val>::minimum(y->right);
+				x = y->right;
+			}
+			if (y != z) {
+				z->left->parent = y;
+				y->left = z->left;
+				if (y != z->right) {
+					xparent = y->parent;
+					left = true;
+					if (x)
+						x->parent = y->parent;
+					y->parent->left = x;
+					y->right = z->right;
+					z->right->parent = y;
+				}
+				else {
+					xparent = y;
+					left = false;
+				}
+				if (root == z)
+					root = y;
+				else if (z->parent->left == z)
+					z->parent->left = y;
+				else
+					z->parent->right = y;
+				y->parent = z->parent;
+				y->color = z->color;
+			}
+			else {
+				xparent = y->parent;
+				left = (root != z && z->parent->left == z);
+				if (x)
+					x->parent = y->parent;
+				if (root == z)
+					root = x;
+				else if (left)
+					z->parent->left = x;
+				else
+					z->parent->right = x;
+				if (header.left == z)
+					header.left = (z->right == 0) ? z->parent : Rb_Node<Val>::minimum(x);
+				if (header.right == z)
+					header.right = (z->left == 0) ? z->parent : Rb_Node<Val>::maximum(x);
+			}
+			_shrunk(xparent, left, header);
+			return z;
+		}
+
+		// Subtree x gained a level: climb while the parents grow too, and
+		// rotate once at the first one left two levels off.
+		template <typename Val>
+		static void	_grown(Rb_Node<Val>* x, Rb_Node<Val>& header) {
+			Rb_Node<Val>*&	root = header.parent;
+
+			for (Rb_Node<Val>* q = x->parent; q != &header; x = q, q = q->parent) {
+				const Color	high = (x == q->left) ? _left_high : _right_high;
+				const Color	low = (x == q->left) ? _right_high : _left_high;
+
+				if (q->color == low) {
+					q->color = _black;
+					return ;
+				}
+				if (q->color == _black) {
+					q->color = high;
+					continue ;
+				}
+				if (x->color == high)
+					_single(q, x, high, root);
+				else
+					_double(q, x, high, root);
+				return ;
+			}
+		}
+
+		// The left subtree of q, or the right one, lost a level: climb
+		// while the parents shrink too.
+		template <typename Val>
+		static void	_shrunk(Rb_Node<Val>* q, bool left, Rb_Node<Val>& header) {
+			Rb_Node<Val>*&	root = header.parent;
+
+			while (q != &header) {
+				Rb_Node<Val>*	up = q->parent;
+				const bool		up_left = (up != &header && q == up->left);
+				const Color		high = left ? _right_high : _left_high;
+				const Color		low = left ? _left_high : _right_high;
+
+				if (q->color == low)
+					q->color = _black;
+				else if (q->color == _black) {
+					q->color = high;
+					return ;
+				}
+				else {
+					Rb_Node<Val>*	s = left ? q->right : q->left;
+
+					if (s->color == _black) {
+						// One rotation and the height is kept.
+						if (left)
+							rotate_left(q, root);
+						else
+							rotate_right(q, root);
+						q->color = high;
+						s->color = low;
+						return ;
+					}
+					if (s->color == high)
+						_single(q, s, high, root);
+					else
+						_double(q, s, high, root);
+				}
+				q = up;
+				left = up_left;
+			}
+		}
+
+		// q is two levels higher on the side of its child c, which leans
+		// the same way: rotate c up.
+		template <typename Val>
+		static void	_single(Rb_Node<Val>* q, Rb_Node<Val>* c, Color high, Rb_Node<Val>*& root) {
+			if (high == _left_high)
+				rotate_right(q, root);
+			else
+				rotate_left(q, root);
+			q->color = _black;
+			c->color = _black;
+		}
+
+		// c leans the other way: rotate its inner child g up twice.
+		template <typename Val>
+		static void	_double(Rb_Node<Val>* q, Rb_Node<Val>* c, Color high, Rb_Node<Val>*& root) {
+			Rb_Node<Val>*	g;
+			const Color		low = (high == _left_high) ? _right_high : _left_high;
+
+			if (high == _left_high) {
+				g = c->right;
+				rotate_left(c, root);
+				rotate_right(q, root);
+			}
+			else {
+				g = c->left;
+				rotate_right(c, root);
+				rotate_left(q, root);
+			}
+			q->color = (g->color == high) ? low : _black;
+			c->color = (g->color == low) ? high : _black;
+			g->color = _black;
+		}
+	};
+
+}//namespace
+
+#endif
@@ -0,0 +1,75 @@
+#pragma once
+# ifndef LIST_BASE_HPP
+# define LIST_BASE_HPP
+
+namespace ft {
+
+	// Links only: the header sentinel of a list is a bare List_node_base,
+	// so no value_type is ever constructed for it.
+	struct	List_node_base {
+		List_node_base*	next;
+		List_node_base*	prev;
+	};
+
+	template <typename T>
+	struct	List_node : public List_node_base {
+		T	value;
+	};
+
+	// Links x just before pos.
+	inline void	list_hook(List_node_base* const x, List_node_base* const pos) {
+		x->next = pos;
+		x->prev = pos->prev;
+		pos->prev->next = x;
+		pos->prev = x;
+	}
+
+	inline void	list_unhook(List_node_base* const x) {
+		x->prev->next = x->next;
+		x->next->prev = x->prev;
+	}
+
+	// Moves [first, last) just before pos, pos must not be in [first, last).
+	inline void	list_transfer(List_node_base* const pos, List_node_base* const first, List_node_base* const last) {
+		if (pos == last || first == last)
+			return ;
+		List_node_base* const	tmp = pos->prev;
+
+		last->prev->next = pos;
+		first->prev->next = last;
+		pos->prev->next = first;
+		pos->prev = last->prev;
+		last->prev = first->prev;
+		first->prev = tmp;
+	}
+
+	inline void	list_reverse(List_node_base* const header) {
+		List_node_base*	x = header;
+
+		do {
+			List_node_base* const	tmp = x->next;
+			x->next = x->prev;
+			x->prev = tmp;
+			x = tmp;
+		} while (x != header);
+	}
+
+	// Swaps the rings hanging off two headers, either may be empty.
+	inline void	list_swap(List_node_base& x, List_node_base& y) {
+		List_node_base	tmp = x;
+
+		x = y;
+		y = tmp;
+		if (x.next == &y)
+			x.next = x.prev = &x;
+		else
+			x.next->prev = x.prev->next = &x;
+		if (y.next == &x)
+			y.next = y.prev = &y;
+		else
+			y.next->prev = y.prev->next = &y;
+	}
+
+}//namespace
+
+#endif
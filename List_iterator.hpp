@@ -0,0 +1,125 @@
+#pragma once
+# ifndef LIST_ITERATOR_HPP
+# define LIST_ITERATOR_HPP
+
+# include "iterator_base.hpp"
+# include "List_base.hpp"
+
+namespace ft {
+
+	template <typename T>
+	struct	List_iterator {
+		typedef T							value_type;
+		typedef T&							reference;
+		typedef T*							pointer;
+		typedef ptrdiff_t					difference_type;
+		typedef List_iterator<T>			Self;
+		typedef List_node<T>				Node;
+		typedef bidirectional_iterator_tag	iterator_category;
+
+		List_iterator() : _node() {}
+
+		explicit List_iterator(List_node_base* x) : _node(x) {}
+
+		reference	operator*() const
+		{ return static_cast<Node*>(_node)->value; }
+
+		pointer	operator->() const
+		{ return &static_cast<Node*>(_node)->value; }
+
+		Self&	operator++() {
+			_node = _node->next;
+			return *this;
+		}
+
+		Self	operator++(int) {
+			Self	tmp = *this;
+			_node = _node->next;
+			return tmp;
+		}
+
+		Self&	operator--() {
+			_node = _node->prev;
+			return *this;
+		}
+
+		Self	operator--(int) {
+			Self	tmp = *this;
+			_node = _node->prev;
+			return tmp;
+		}
+
+		bool	operator==(const Self& x) const
+		{ return _node == x._node; }
+
+		bool	operator!=(const Self& x) const
+		{ return _node != x._node; }
+
+		List_node_base*	_node;
+	};
+
+	template <typename T>
+	struct	List_const_iterator {
+		typedef T							value_type;
+		typedef const T&					reference;
+		typedef const T*					pointer;
+		typedef ptrdiff_t					difference_type;
+		typedef List_iterator<T>			iterator;
+		typedef List_const_iterator<T>		Self;
+		typedef const List_node<T>			Node;
+		typedef bidirectional_iterator_tag	iterator_category;
+
+		List_const_iterator() : _node() {}
+
+		explicit List_const_iterator(const List_node_base* x) : _node(x) {}
+
+		List_const_iterator(const iterator& it) : _node(it._node) {}
+
+		reference	operator*() const
+		{ return static_cast<Node*>(_node)->value; }
+
+		pointer	operator->() const
+		{ return &static_cast<Node*>(_node)->value; }
+
+		Self&	operator++() {
+			_node = _node->next;
+			return *this;
+		}
+
+		Self	operator++(int) {
+			Self	tmp = *this;
+			_node = _node->next;
+			return tmp;
+		}
+
+		Self&	operator--() {
+			_node = _node->prev;
+			return *this;
+		}
+
+		Self	operator--(int) {
+			Self	tmp = *this;
+			_node = _node->prev;
+			return tmp;
+		}
+
+		bool	operator==(const Self& x) const
+		{ return _node == x._node; }
+
+		bool	operator!=(const Self& x) const
+		{ return _node != x._node; }
+
+		const List_node_base*	_node;
+	};
+
+	template <typename T>
+	inline bool	operator==(const List_iterator<T>& x, const List_const_iterator<T>& y)
+	{ return x._node == y._node; }
+
+	template <typename T>
+	inline bool	operator!=(const List_iterator<T>& x, const List_const_iterator<T>& y)
+	{ return x._node != y._node; }
+
+}//namespace
+
+#endif
@@ -2,7 +2,9 @@
 #ifndef RB_ALGO_HPP
 # define RB_ALGO_HPP
 
+# include <algorithm>
 # include "Rb_base.hpp"
+# include "type_traits.hpp"
 
 namespace ft {
 
@@ -51,6 +53,12 @@ namespace ft {
 		x->left = 0;
 		x->right = 0;
 		x->color = _red;
+# ifdef FT_RB_THREADED
+		if (insertleft)
+			rb_link_before(x, p);
+		else
+			rb_link_before(x, p->next);
+# endif
 		// Insert.
 		// Make new node child of parent and maintain root, leftmost and
 		// rightmost nodes.
@@ -122,6 +130,9 @@ namespace ft {
 		Rb_Node<Val>*	x = 0;
 		Rb_Node<Val>*	xparent = 0;
 
+# ifdef FT_RB_THREADED
+		rb_unlink(z);
+# endif
 		if (y->left == 0)     // __z has at most one non-null child. y == z.
 			x = y->right;     // __x might be null.
 		else {
@@ -252,6 +263,24 @@ namespace ft {
 		return y;
 	}
 
+	// Balancing policy of Rb_tree: how a new node is linked, how a node
+	// is unlinked, and what a lookup does to the node it found. balanced
+	// tells whether the height stays O(log n).
+	struct	Rb_balance {
+		typedef true_type	balanced;
+
+		template <typename Val>
+		static void	insert(bool insert_left, Rb_Node<Val>* x, Rb_Node<Val>* p, Rb_Node<Val>& header)
+		{ insert_and_rebalance(insert_left, x, p, header); }
+
+		template <typename Val>
+		static Rb_Node<Val>*	erase(Rb_Node<Val>* z, Rb_Node<Val>& header)
+		{ return rebalance_for_erase(z, header); }
+
+		template <typename Val>
+		static void	access(Rb_Node<Val>*, Rb_Node<Val>&) {}
+	};
+
 }//namespace
 
 #endif
\ No newline at end of file
@@ -4,7 +4,10 @@
 
 namespace ft {
 
-	enum	Color { _red = false, _black = true };
+	// Avl_balance keeps its balance factor in the same field: _black when
+	// both subtrees are as high, else the higher side. Never _red, so the
+	// header stays the only red node above the root.
+	enum	Color { _red = false, _black = true, _left_high = 2, _right_high = 3 };
 
 	template <typename Val>
 	struct	Rb_Node {
@@ -16,6 +19,10 @@ namespace ft {
 		Node_ptr	parent;
 		Node_ptr	left;
 		Node_ptr	right;
+# ifdef FT_RB_THREADED
+		Node_ptr	prev;
+		Node_ptr	next;
+# endif
 		Val			value;
 
 		static Node_ptr	minimum(Node_ptr x) {
@@ -39,6 +46,24 @@ namespace ft {
 		}
 	};
 
+# ifdef FT_RB_THREADED
+	// With FT_RB_THREADED defined every node also sits in a circular
+	// in-order list through the header, so iterators step with one load.
+	template <typename Val>
+	inline void	rb_link_before(Rb_Node<Val>* x, Rb_Node<Val>* pos) {
+		x->prev = pos->prev;
+		x->next = pos;
+		pos->prev->next = x;
+		pos->prev = x;
+	}
+
+	template <typename Val>
+	inline void	rb_unlink(Rb_Node<Val>* x) {
+		x->prev->next = x->next;
+		x->next->prev = x->prev;
+	}
+# endif
+
 }//namespace
 
 #endif
\ No newline at end of file
@@ -0,0 +1,97 @@
+#pragma once
+# ifndef RB_CACHE_HPP
+# define RB_CACHE_HPP
+
+# include <algorithm>
+# include <cstddef>
+# include "functional.hpp"
+# include "type_traits.hpp"
+
+namespace ft {
+
+	// Lookup policies of Rb_tree. The default one keeps nothing.
+	struct	Rb_no_cache {
+		typedef false_type	enabled;
+
+		void	clear() {}
+		void	swap(Rb_no_cache&) {}
+
+		template <typename Key>
+		void	erase(const Key&, const void*) {}
+	};
+
+	// Direct-mapped cache of 2^Bits slots, from key hash to the node last
+	// found for a key of that slot. A hit costs one key check and no
+	// descent, a miss one more check than a plain lookup: it pays off when
+	// a few keys take most lookups. Const lookups fill it, so a tree using
+	// it must not be read from several threads at once. Bits must be
+	// above 0 and below the width of size_t.
+	template <typename Hash, unsigned Bits = 8>
+	class	Rb_hot_cache {
+
+		private:
+			// C++98 static assertion: _index() shifts by the width minus Bits.
+			typedef char	_bits_in_range[Bits > 0 && Bits < sizeof(size_t) * 8 ? 1 : -1];
+
+		public:
+			typedef true_type	enabled;
+
+			Rb_hot_cache() : hits(0), misses(0) { clear(); }
+
+			// A copy belongs to another tree, it starts empty.
+			Rb_hot_cache(const Rb_hot_cache&) : hits(0), misses(0) { clear(); }
+
+			Rb_hot_cache&	operator=(const Rb_hot_cache&) {
+				clear();
+				return *this;
+			}
+
+			template <typename Key>
+			const void*	get(const Key& k) const { return _slots[_index(k)]; }
+
+			template <typename Key>
+			void	put(const Key& k, const void* node) { _slots[_index(k)] = node; }
+
+			// Forgets node, about to be freed, if it holds the slot of k.
+			template <typename Key>
+			void	erase(const Key& k, const void* node) {
+				size_t	i = _index(k);
+
+				if (_slots[i] == node)
+					_slots[i] = 0;
+			}
+
+			void	clear() {
+				for (size_t i = 0; i < slots; ++i)
+					_slots[i] = 0;
+			}
+
+			void	swap(Rb_hot_cache& x) {
+				for (size_t i = 0; i < slots; ++i) {
+					const void*	tmp = _slots[i];
+
+					_slots[i] = x._slots[i];
+					x._slots[i] = tmp;
+				}
+				std::swap(hits, x.hits);
+				std::swap(misses, x.misses);
+			}
+
+			static const size_t	slots = size_t(1) << Bits;
+
+			size_t	hits;
+			size_t	misses;
+
+		private:
+			// Fibonacci hashing: the top Bits of the product, so that keys
+			// differing in any bit spread over the slots.
+			template <typename Key>
+			size_t	_index(const Key& k) const
+			{ return (Hash()(k) * static_cast<size_t>(0x9E3779B97F4A7C15ULL)) >> (sizeof(size_t) * 8 - Bits); }
+
+			const void*	_slots[size_t(1) << Bits];
+	};
+
+}//namespace
+
+#endif
@@ -28,6 +28,9 @@ namespace ft {
 		{ return &_node->value; }
 
 		Self&	operator++() {
+# ifdef FT_RB_THREADED
+			_node = _node->next;
+# else
 			Node_ptr	y(0);
 
 			if (_node->right != 0) {
@@ -44,6 +47,7 @@ namespace ft {
 				if (_node->right != y)
 					_node = y;
 			}
+# endif
 			return *this;
 		}
 
@@ -54,6 +58,9 @@ namespace ft {
 		}
 
 		Self& operator--() {
+# ifdef FT_RB_THREADED
+			_node = _node->prev;
+# else
 			Node_ptr	y(0);
 
 			if (_node->color == _red && _node->parent->parent == _node)
@@ -72,6 +79,7 @@ namespace ft {
 				}
 				_node = y;
 			}
+# endif
 			return *this;
 		}
 
@@ -115,6 +123,9 @@ namespace ft {
 		{ return &_node->value; }
 
 		Self&	operator++() {
+# ifdef FT_RB_THREADED
+			_node = _node->next;
+# else
 			Node_ptr	y(0);
 
 			if (_node->right != 0) {
@@ -131,6 +142,7 @@ namespace ft {
 				if (_node->right != y)
 					_node = y;
 			}
+# endif
 			return *this;
 		}
 
@@ -141,6 +153,9 @@ namespace ft {
 		}
 
 		Self& operator--() {
+# ifdef FT_RB_THREADED
+			_node = _node->prev;
+# else
 			Node_ptr	y(0);
 
 			if (_node->color == _red && _node->parent->parent == _node)
@@ -159,6 +174,7 @@ namespace ft {
 				}
 				_node = y;
 			}
+# endif
 			return *this;
 		}
 
@@ -177,6 +193,122 @@ namespace ft {
 		Node_ptr	_node;
 	};
 
+	// Reverse iterator holding the node it points at. ft::reverse_iterator
+	// holds the next position and steps back on every dereference, which
+	// costs a tree walk per element here. base() keeps its meaning, but
+	// unlike std::reverse_iterator this one is invalidated by erasing the
+	// element it points at, and does not move to a value inserted just
+	// before base().
+	template <typename Iterator>
+	struct	Rb_reverse_iterator {
+		typedef Iterator								iterator_type;
+		typedef typename Iterator::value_type			value_type;
+		typedef typename Iterator::reference			reference;
+		typedef typename Iterator::pointer				pointer;
+		typedef typename Iterator::difference_type		difference_type;
+		typedef typename Iterator::iterator_category	iterator_category;
+		typedef typename Iterator::Node_ptr				Node_ptr;
+		typedef Rb_reverse_iterator<Iterator>			Self;
+
+		Rb_reverse_iterator() : _node() {}
+
+		explicit Rb_reverse_iterator(iterator_type x) : _node(_prev(x._node)) {}
+
+		template <typename Iter>
+		Rb_reverse_iterator(const Rb_reverse_iterator<Iter>& x) : _node(x._node) {}
+
+		iterator_type	base() const
+		{ return iterator_type(_next(_node)); }
+
+		reference	operator*() const
+		{ return _node->value; }
+
+		pointer	operator->() const
+		{ return &_node->value; }
+
+		Self&	operator++() {
+			_node = _prev(_node);
+			return *this;
+		}
+
+		Self	operator++(int) {
+			Self	tmp = *this;
+			_node = _prev(_node);
+			return tmp;
+		}
+
+		Self&	operator--() {
+			_node = _next(_node);
+			return *this;
+		}
+
+		Self	operator--(int) {
+			Self	tmp = *this;
+			_node = _next(_node);
+			return tmp;
+		}
+
+		// The header is the only red node whose grandparent is itself, or
+		// without parent in an empty tree.
+		static bool	_is_header(Node_ptr x)
+		{ return x->color == _red && (x->parent == 0 || x->parent->parent == x); }
+
+		// Predecessor, the header before the first node and the last node
+		// before the header.
+		static Node_ptr	_prev(Node_ptr x) {
+# ifdef FT_RB_THREADED
+			return x->prev;
+# else
+			if (_is_header(x))
+				return x->right;
+			if (x->left != 0) {
+				x = x->left;
+				while (x->right != 0)
+					x = x->right;
+				return x;
+			}
+			Node_ptr	y = x->parent;
+			while (x == y->left) {
+				x = y;
+				y = y->parent;
+			}
+			// Climbed past the header from a root that is the first node.
+			return x->left != y ? y : x;
+# endif
+		}
+
+		static Node_ptr	_next(Node_ptr x) {
+# ifdef FT_RB_THREADED
+			return x->next;
+# else
+			if (_is_header(x))
+				return x->left;
+			if (x->right != 0) {
+				x = x->right;
+				while (x->left != 0)
+					x = x->left;
+				return x;
+			}
+			Node_ptr	y = x->parent;
+			while (x == y->right) {
+				x = y;
+				y = y->parent;
+			}
+			return x->right != y ? y : x;
+# endif
+		}
+
+		Node_ptr	_node;
+	};
+
+	template <typename IteratorL, typename IteratorR>
+	inline bool	operator==(const Rb_reverse_iterator<IteratorL>& x, const Rb_reverse_iterator<IteratorR>& y)
+	{ return x._node == y._node; }
+
+	template <typename IteratorL, typename IteratorR>
+	inline bool	operator!=(const Rb_reverse_iterator<IteratorL>& x, const Rb_reverse_iterator<IteratorR>& y)
+	{ return x._node != y._node; }
+
 	template <typename Val>
 	inline bool	operator==(const Rb_iterator<Val>& x, const Rb_Const_iterator<Val>& y)
 	{ return x._node == y._node; }
@@ -0,0 +1,145 @@
+#pragma once
+# ifndef SPLAY_ALGO_HPP
+# define SPLAY_ALGO_HPP
+
+# include "Rb_algo.hpp"
+
+namespace ft {
+
+	// Splay tree policy for Rb_tree: every node inserted or found is
+	// rotated up to the root, so a small working set stays a few levels
+	// deep. Nodes are all black, the red header keeps telling itself
+	// apart. The height is not bounded, and lookups, const ones included,
+	// reshape the tree: it must not be read from several threads at once.
+	struct	Splay_balance {
+		typedef false_type	balanced;
+
+		// Bottom-up splay with the parent links: zig-zig rotates the
+		// grandparent first, zig-zag the parent then the grandparent.
+		template <typename Val>
+		static void	access(Rb_Node<Val>* x, Rb_Node<Val>& header) {
+			Rb_Node<Val>*&	root = header.parent;
+
+			while (x != root) {
+				Rb_Node<Val>*	p = x->parent;
+				Rb_Node<Val>*	g = p->parent;
+
+				if (p == root) {
+					if (x == p->left)
+						rotate_right(p, root);
+					else
+						rotate_left(p, root);
+				}
+				else if (x == p->left && p == g->left) {
+					rotate_right(g, root);
+					rotate_right(p, root);
+				}
+				else if (x == p->right && p == g->right) {
+					rotate_left(g, root);
+					rotate_left(p, root);
+				}
+				else if (x == p->left) {
+					rotate_right(p, root);
+					rotate_left(g, root);
+				}
+				else {
+					rotate_left(p, root);
+					rotate_right(g, root);
+				}
+			}
+		}
+
+		template <typename Val>
+		static void	insert(bool insert_left, Rb_Node<Val>* x, Rb_Node<Val>* p, Rb_Node<Val>& header) {
+			x->parent = p;
+			x->left = 0;
+			x->right = 0;
+			x->color = _black;
+# ifdef FT_RB_THREADED
+			if (insert_left)
+				rb_link_before(x, p);
+			else
+				rb_link_before(x, p->next);
+# endif
+			if (insert_left) {
+				p->left = x;
+				if (p == &header) {
+					header.parent = x;
+					header.right = x;
+				}
+				else if (p == header.left)
+					header.left = x;
+			}
+			else {
+				p->right = x;
+				if (p == header.right)
+					header.right = x;
+			}
+			access(x, header);
+		}
+
+		// Unlinks z as rebalance_for_erase() does, without colors, then
+		// splays the parent of the node that left its place.
+		template <typename Val>
+		static Rb_Node<Val>*	erase(Rb_Node<Val>* const z, Rb_Node<Val>& header) {
+			Rb_Node<Val>*&	root = header.parent;
+			Rb_Node<Val>*	y = z;
+			Rb_Node<Val>*	x = 0;
+			Rb_Node<Val>*	xparent = 0;
+
+# ifdef FT_RB_THREADED
+			rb_unlink(z);
+# endif
+			if (y->left == 0)
+				x = y->right;
+			else if (y->right == 0)
+				x = y->left;
+			else {
+				y = Rb_Node<Val>::minimum(y->right);
+				x = y->right;
+			}
+			if (y != z) {
+				z->left->parent = y;
+				y->left = z->left;
+				if (y != z->right) {
+					xparent = y->parent;
+					if (x)
+						x->parent = y->parent;
+					y->parent->left = x;
+					y->right = z->right;
+					z->right->parent = y;
+				}
+				else
+					xparent = y;
+				if (root == z)
+					root = y;
+				else if (z->parent->left == z)
+					z->parent->left = y;
+				else
+					z->parent->right = y;
+				y->parent = z->parent;
+			}
+			else {
+				xparent = y->parent;
+				if (x)
+					x->parent = y->parent;
+				if (root == z)
+					root = x;
+				else if (z->parent->left == z)
+					z->parent->left = x;
+				else
+					z->parent->right = x;
+				if (header.left == z)
+					header.left = (z->right == 0) ? z->parent : Rb_Node<Val>::minimum(x);
+				if (header.right == z)
+					header.right = (z->left == 0) ? z->parent : Rb_Node<Val>::maximum(x);
+			}
+			if (xparent != &header)
+				access(xparent, header);
+			return z;
+		}
+	};
+
+}//namespace
+
+#endif
@@ -0,0 +1,363 @@
+#pragma once
+# ifndef CIRCULAR_BUFFER_HPP
+# define CIRCULAR_BUFFER_HPP
+
+# include <memory>
+# include <stdexcept>
+# include "iterator.hpp"
+# include "algorithm.hpp"
+# include "utility.hpp"
+
+namespace ft {
+
+	// Random access over a ring: _pos is the logical index from the
+	// oldest element, the physical slot wraps once past _cap.
+	template <typename T, typename Pointer, typename Reference>
+	struct	Ring_iterator {
+		typedef T										value_type;
+		typedef Reference								reference;
+		typedef Pointer									pointer;
+		typedef ptrdiff_t								difference_type;
+		typedef random_access_iterator_tag				iterator_category;
+		typedef Ring_iterator<T, Pointer, Reference>	Self;
+		typedef Ring_iterator<T, T*, T&>				iterator;
+
+		Ring_iterator() : _buf(), _cap(0), _head(0), _pos(0) {}
+
+		Ring_iterator(Pointer buf, size_t cap, size_t head, size_t pos)
+		: _buf(buf), _cap(cap), _head(head), _pos(pos) {}
+
+		//normal to const
+		Ring_iterator(const iterator& it) : _buf(it._buf), _cap(it._cap), _head(it._head), _pos(it._pos) {}
+
+		reference	operator*() const
+		{ return _buf[_slot(_pos)]; }
+
+		pointer	operator->() const
+		{ return &_buf[_slot(_pos)]; }
+
+		reference	operator[](difference_type n) const
+		{ return _buf[_slot(_pos + n)]; }
+
+		Self&	operator++() {
+			++_pos;
+			return *this;
+		}
+
+		Self	operator++(int) {
+			Self	tmp = *this;
+			++_pos;
+			return tmp;
+		}
+
+		Self&	operator--() {
+			--_pos;
+			return *this;
+		}
+
+		Self	operator--(int) {
+			Self	tmp = *this;
+			--_pos;
+			return tmp;
+		}
+
+		Self&	operator+=(difference_type n) {
+			_pos += n;
+			return *this;
+		}
+
+		Self	operator+(difference_type n) const
+		{ return Self(_buf, _cap, _head, _pos + n); }
+
+		Self&	operator-=(difference_type n) {
+			_pos -= n;
+			return *this;
+		}
+
+		Self	operator-(difference_type n) const
+		{ return Self(_buf, _cap, _head, _pos - n); }
+
+		size_t	_slot(size_t pos) const {
+			const size_t	i = _head + pos;
+			return i < _cap ? i : i - _cap;
+		}
+
+		Pointer	_buf;
+		size_t	_cap;
+		size_t	_head;
+		size_t	_pos;
+	};
+
+# define _HEADER_RING_IT \
+	template <typename T, typename PL, typename RL, typename PR, typename RR>
+
+	_HEADER_RING_IT
+	inline bool	operator==(const Ring_iterator<T, PL, RL>& x, const Ring_iterator<T, PR, RR>& y)
+	{ return x._pos == y._pos; }
+
+	_HEADER_RING_IT
+	inline bool	operator!=(const Ring_iterator<T, PL, RL>& x, const Ring_iterator<T, PR, RR>& y)
+	{ return x._pos != y._pos; }
+
+	_HEADER_RING_IT
+	inline bool	operator<(const Ring_iterator<T, PL, RL>& x, const Ring_iterator<T, PR, RR>& y)
+	{ return x._pos < y._pos; }
+
+	_HEADER_RING_IT
+	inline bool	operator>(const Ring_iterator<T, PL, RL>& x, const Ring_iterator<T, PR, RR>& y)
+	{ return x._pos > y._pos; }
+
+	_HEADER_RING_IT
+	inline bool	operator<=(const Ring_iterator<T, PL, RL>& x, const Ring_iterator<T, PR, RR>& y)
+	{ return x._pos <= y._pos; }
+
+	_HEADER_RING_IT
+	inline bool	operator>=(const Ring_iterator<T, PL, RL>& x, const Ring_iterator<T, PR, RR>& y)
+	{ return x._pos >= y._pos; }
+
+	_HEADER_RING_IT
+	inline ptrdiff_t	operator-(const Ring_iterator<T, PL, RL>& x, const Ring_iterator<T, PR, RR>& y)
+	{ return ptrdiff_t(x._pos - y._pos); }
+
+	template <typename T, typename P, typename R>
+	inline Ring_iterator<T, P, R>	operator+(ptrdiff_t n, const Ring_iterator<T, P, R>& x)
+	{ return x + n; }
+
+	// Fixed capacity ring, allocated once at construction. Pushing into a
+	// full buffer overwrites the element at the opposite end.
+	template <typename T, typename Alloc = std::allocator<T> >
+	class	circular_buffer {
+
+		public:
+			typedef T													value_type;
+			typedef typename Alloc::reference							reference;
+			typedef typename Alloc::const_reference						const_reference;
+			typedef typename Alloc::pointer								pointer;
+			typedef typename Alloc::const_pointer						const_pointer;
+			typedef Ring_iterator<T, pointer, reference>				iterator;
+			typedef Ring_iterator<T, const_pointer, const_reference>	const_iterator;
+			typedef ft::reverse_iterator<iterator>						reverse_iterator;
+			typedef ft::reverse_iterator<const_iterator>				const_reverse_iterator;
+			typedef ptrdiff_t											difference_type;
+			typedef size_t												size_type;
+			typedef Alloc												allocator_type;
+			typedef pair<pointer, size_type>							array_range;
+			typedef pair<const_pointer, size_type>						const_array_range;
+
+		private:
+			size_type	_slot(size_type pos) const {
+				const size_type	i = _head + pos;
+				return i < _cap ? i : i - _cap;
+			}
+
+			void	_check_range(size_type n) const
+			{ if (n >= _size) throw std::out_of_range("circular_buffer::_range_check"); }
+
+		protected:
+			allocator_type	_impl;
+			pointer			_buf;
+			size_type		_cap;
+			size_type		_head;
+			size_type		_size;
+
+		public:
+			//Constructors
+			explicit circular_buffer(size_type capacity = 0, const allocator_type& alloc = allocator_type())
+			: _impl(alloc), _buf(0), _cap(capacity), _head(0), _size(0) {
+				if (_cap > max_size())
+					throw std::length_error("circular_buffer::circular_buffer");
+				if (_cap != 0)
+					_buf = _impl.allocate(_cap);
+			}
+
+			circular_buffer(const circular_buffer& x)
+			: _impl(x._impl), _buf(0), _cap(x._cap), _head(0), _size(0) {
+				if (_cap != 0)
+					_buf = _impl.allocate(_cap);
+				try {
+					for (const_iterator it = x.begin(); it != x.end(); ++it)
+						push_back(*it);
+				}
+				catch (...) {
+					clear();
+					if (_buf != 0)
+						_impl.deallocate(_buf, _cap);
+					throw ;
+				}
+			}
+
+			//Destructor
+			~circular_buffer() {
+				clear();
+				if (_buf != 0)
+					_impl.deallocate(_buf, _cap);
+			}
+
+			//Assign operator, keeps the storage when capacities match
+			circular_buffer&	operator=(const circular_buffer& x) {
+				if (this != &x) {
+					if (_cap != x._cap) {
+						circular_buffer	tmp(x);
+						swap(tmp);
+					}
+					else {
+						clear();
+						for (const_iterator it = x.begin(); it != x.end(); ++it)
+							push_back(*it);
+					}
+				}
+				return *this;
+			}
+
+			//Iterators
+			iterator				begin() { return iterator(_buf, _cap, _head, 0); }
+			const_iterator			begin() const { return const_iterator(_buf, _cap, _head, 0); }
+			iterator				end() { return iterator(_buf, _cap, _head, _size); }
+			const_iterator			end() const { return const_iterator(_buf, _cap, _head, _size); }
+			reverse_iterator		rbegin() { return reverse_iterator(end()); }
+			const_reverse_iterator	rbegin() const { return const_reverse_iterator(end()); }
+			reverse_iterator		rend() { return reverse_iterator(begin()); }
+			const_reverse_iterator	rend() const { return const_reverse_iterator(begin()); }
+
+			//Capacity
+			bool		empty() const { return _size == 0; }
+			bool		full() const { return _size == _cap; }
+			size_type	size() const { return _size; }
+			size_type	capacity() const { return _cap; }
+			size_type	max_size() const { return _impl.max_size(); }
+
+			//Element access
+			reference		operator[](size_type n) { return _buf[_slot(n)]; }
+			const_reference	operator[](size_type n) const { return _buf[_slot(n)]; }
+
+			reference	at(size_type n) {
+				_check_range(n);
+				return (*this)[n];
+			}
+
+			const_reference	at(size_type n) const {
+				_check_range(n);
+				return (*this)[n];
+			}
+
+			reference		front() { return _buf[_head]; }
+			const_reference	front() const { return _buf[_head]; }
+			reference		back() { return _buf[_slot(_size - 1)]; }
+			const_reference	back() const { return _buf[_slot(_size - 1)]; }
+
+			// The live range is [array_one, array_two) in storage order,
+			// array_two is empty unless the range wraps.
+			array_range	array_one() {
+				const size_type	n = (_cap - _head < _size) ? _cap - _head : _size;
+				return array_range(_buf + _head, n);
+			}
+
+			const_array_range	array_one() const {
+				const size_type	n = (_cap - _head < _size) ? _cap - _head : _size;
+				return const_array_range(_buf + _head, n);
+			}
+
+			array_range			array_two() { return array_range(_buf, _size - array_one().second); }
+			const_array_range	array_two() const { return const_array_range(_buf, _size - array_one().second); }
+
+			// Copies the live range oldest first, as two plain pointer loops.
+			template <typename OutputIterator>
+			OutputIterator	copy_out(OutputIterator out) const {
+				const_array_range	span = array_one();
+
+				for (const_pointer p = span.first; p != span.first + span.second; ++p, ++out)
+					*out = *p;
+				span = array_two();
+				for (const_pointer p = span.first; p != span.first + span.second; ++p, ++out)
+					*out = *p;
+				return out;
+			}
+
+			//Modifiers
+			void	push_back(const value_type& val) {
+				if (_cap == 0)
+					return ;
+				if (_size == _cap) {
+					_buf[_head] = val;
+					_head = _slot(1);
+				}
+				else {
+					_impl.construct(_buf + _slot(_size), val);
+					++_size;
+				}
+			}
+
+			void	push_front(const value_type& val) {
+				if (_cap == 0)
+					return ;
+				const size_type	slot = (_head == 0) ? _cap - 1 : _head - 1;
+
+				if (_size == _cap)
+					_buf[slot] = val;
+				else {
+					_impl.construct(_buf + slot, val);
+					++_size;
+				}
+				_head = slot;
+			}
+
+			void	pop_back() {
+				--_size;
+				_impl.destroy(_buf + _slot(_size));
+			}
+
+			void	pop_front() {
+				_impl.destroy(_buf + _head);
+				_head = _slot(1);
+				--_size;
+			}
+
+			void	clear() {
+				while (_size != 0)
+					pop_back();
+				_head = 0;
+			}
+
+			void	swap(circular_buffer& x) {
+				std::swap(_impl, x._impl);
+				std::swap(_buf, x._buf);
+				std::swap(_cap, x._cap);
+				std::swap(_head, x._head);
+				std::swap(_size, x._size);
+			}
+
+			//Allocator
+			allocator_type	get_allocator() const { return _impl; }
+	};
+
+	template <typename T, typename Alloc>
+	bool	operator==(const circular_buffer<T,Alloc>& x, const circular_buffer<T,Alloc>& y)
+	{ return (x.size() == y.size() && ft::equal(x.begin(), x.end(), y.begin())); }
+
+	template <typename T, typename Alloc>
+	bool	operator<(const circular_buffer<T,Alloc>& x, const circular_buffer<T,Alloc>& y)
+	{ return ft::lexicographical_compare(x.begin(), x.end(), y.begin(), y.end()); }
+
+	template <typename T, typename Alloc>
+	bool	operator!=(const circular_buffer<T,Alloc>& x, const circular_buffer<T,Alloc>& y)
+	{ return !(x == y); }
+
+	template <typename T, typename Alloc>
+	bool	operator<=(const circular_buffer<T,Alloc>& x, const circular_buffer<T,Alloc>& y)
+	{ return !(y < x); }
+
+	template <typename T, typename Alloc>
+	bool	operator>(const circular_buffer<T,Alloc>& x, const circular_buffer<T,Alloc>& y)
+	{ return (y < x); }
+
+	template <typename T, typename Alloc>
+	bool	operator>=(const circular_buffer<T,Alloc>& x, const circular_buffer<T,Alloc>& y)
+	{ return !(x < y); }
+
+	template <typename T, typename Alloc>
+	void	swap(circular_buffer<T, Alloc>& x, circular_buffer<T, Alloc>& y)
+	{ x.swap(y); }
+
+}//namespace
+
+#endif
@@ -0,0 +1,163 @@
+#pragma once
+# ifndef CONCURRENT_BASE_HPP
+# define CONCURRENT_BASE_HPP
+
+# if __cplusplus < 201103L
+#  error "concurrent containers need <atomic>, build with -std=c++11 or later"
+# endif
+
+# include <atomic>
+# include <climits>
+# include <cstddef>
+# include <stdint.h>
+# include <thread>
+# ifdef __linux__
+#  include <linux/futex.h>
+#  include <sys/syscall.h>
+#  include <unistd.h>
+# endif
+
+# ifndef FT_CACHE_LINE
+#  define FT_CACHE_LINE 64
+# endif
+
+namespace ft {
+
+	// Gives a value a cache line of its own so that writers of
+	// neighbouring fields do not invalidate it (false sharing).
+	// Heap objects only honour the alignment from C++17 on.
+	template <typename T>
+	struct	alignas(FT_CACHE_LINE) cache_padded {
+		T	value;
+
+		cache_padded() : value() {}
+	};
+
+	inline void	cpu_relax() {
+# if defined(__x86_64__) || defined(__i386__)
+		__builtin_ia32_pause();
+# elif defined(__aarch64__)
+		asm volatile("yield" ::: "memory");
+# endif
+	}
+
+	// Spins a little, then gives the core away.
+	inline void	backoff(unsigned& spins) {
+		if (spins < 64) {
+			cpu_relax();
+			++spins;
+		}
+		else
+			std::this_thread::yield();
+	}
+
+	// Reader-writer spinlock in one word: reader count in the low bits,
+	// a held bit and a pending bit for writers. A pending writer stops new
+	// readers from coming in, so writers are not starved by read traffic.
+	class	rw_spinlock {
+
+		public:
+			rw_spinlock() : _state(0) {}
+
+			void	lock_shared() {
+				unsigned	spins = 0;
+
+				for (;;) {
+					uint32_t	s = _state.load(std::memory_order_relaxed);
+					if (!(s & (_writer | _pending))
+						&& _state.compare_exchange_weak(s, s + 1, std::memory_order_acquire, std::memory_order_relaxed))
+						return ;
+					backoff(spins);
+				}
+			}
+
+			void	unlock_shared() { _state.fetch_sub(1, std::memory_order_release); }
+
+			void	lock() {
+				unsigned	spins = 0;
+
+				for (;;) {
+					uint32_t	s = _state.load(std::memory_order_relaxed);
+					if ((s & ~_pending) == 0) {
+						if (_state.compare_exchange_weak(s, _writer, std::memory_order_acquire, std::memory_order_relaxed))
+							return ;
+					}
+					else if (!(s & _pending))
+						_state.fetch_or(_pending, std::memory_order_relaxed);
+					backoff(spins);
+				}
+			}
+
+			void	unlock() { _state.fetch_and(~_writer, std::memory_order_release); }
+
+		private:
+			static const uint32_t	_writer = 1u << 31;
+			static const uint32_t	_pending = 1u << 30;
+
+			std::atomic<uint32_t>	_state;
+	};
+
+	// Sleeps while word still holds expected, may return spuriously.
+	inline void	futex_wait(std::atomic<uint32_t>& word, uint32_t expected) {
+# ifdef __linux__
+		syscall(SYS_futex, reinterpret_cast<uint32_t*>(&word), FUTEX_WAIT_PRIVATE, expected, 0, 0, 0);
+# else
+		if (word.load(std::memory_order_acquire) == expected)
+			std::this_thread::yield();
+# endif
+	}
+
+	inline void	futex_wake_all(std::atomic<uint32_t>& word) {
+# ifdef __linux__
+		syscall(SYS_futex, reinterpret_cast<uint32_t*>(&word), FUTEX_WAKE_PRIVATE, INT_MAX, 0, 0, 0);
+# else
+		(void)word;
+# endif
+	}
+
+	// Sleep/wake point for blocking operations: waiters spin first, then
+	// register and sleep on the epoch word. The fences pair up so that
+	// either the waiter sees the change or the notifier sees the waiter,
+	// notify() is a fence and a load when nobody is sleeping.
+	class	Event_count {
+
+		public:
+			Event_count() : _epoch(0), _waiters(0) {}
+
+			void	notify() {
+				std::atomic_thread_fence(std::memory_order_seq_cst);
+				if (_waiters.load(std::memory_order_relaxed) != 0) {
+					_epoch.fetch_add(1, std::memory_order_seq_cst);
+					futex_wake_all(_epoch);
+				}
+			}
+
+			// Retries op until it succeeds, spinning spins times before sleeping.
+			template <typename Op>
+			void	wait_until(Op op, unsigned spins = 1024) {
+				for (unsigned i = 0; i < spins; ++i) {
+					if (op())
+						return ;
+					cpu_relax();
+				}
+				for (;;) {
+					_waiters.fetch_add(1, std::memory_order_seq_cst);
+					std::atomic_thread_fence(std::memory_order_seq_cst);
+					const uint32_t	ticket = _epoch.load(std::memory_order_acquire);
+					if (op()) {
+						_waiters.fetch_sub(1, std::memory_order_relaxed);
+						return ;
+					}
+					futex_wait(_epoch, ticket);
+					_waiters.fetch_sub(1, std::memory_order_relaxed);
+				}
+			}
+
+		private:
+			std::atomic<uint32_t>	_epoch;
+			std::atomic<uint32_t>	_waiters;
+	};
+
+}//namespace
+
+#endif
@@ -0,0 +1,215 @@
+#pragma once
+# ifndef CONCURRENT_MAP_HPP
+# define CONCURRENT_MAP_HPP
+
+# include <functional>
+# include <mutex>
+# include <new>
+# include <type_traits>
+# include "concurrent_base.hpp"
+# include "map.hpp"
+
+namespace ft {
+
+	// Default partition: std::hash spread by a multiplicative mix, so that
+	// identity hashes of small integers do not pile into one shard.
+	template <typename Key>
+	struct	hash_partition {
+		size_t	operator()(const Key& k) const {
+			const uint64_t	h = static_cast<uint64_t>(std::hash<Key>()(k)) * 0x9E3779B97F4A7C15ull;
+			return static_cast<size_t>(h >> 32);
+		}
+	};
+
+	// Map split over Shards independent ft::map, each behind its own
+	// reader-writer lock on its own cache line. Partition maps a key to a
+	// shard index (taken modulo Shards): pass a monotonic one for range
+	// partitioning, then snapshot() and for_each() come out in key order.
+	template <typename Key, typename T, typename Compare = ft::less<Key>, size_t Shards = 16,
+			typename Partition = hash_partition<Key>, typename Alloc = std::allocator<pair<const Key, T> > >
+	class	concurrent_map {
+
+		public:
+			typedef Key								key_type;
+			typedef T								mapped_type;
+			typedef pair<const Key, T>				value_type;
+			typedef Compare							key_compare;
+			typedef Alloc							allocator_type;
+			typedef size_t							size_type;
+			typedef ft::map<Key, T, Compare, Alloc>	shard_type;
+
+		private:
+			struct	alignas(FT_CACHE_LINE) Shard {
+				mutable rw_spinlock	lock;
+				shard_type			map;
+
+				Shard(const Compare& comp, const Alloc& alloc) : lock(), map(comp, alloc) {}
+			};
+
+			struct	Read_guard {
+				explicit Read_guard(rw_spinlock& l) : _l(l) { _l.lock_shared(); }
+				~Read_guard() { _l.unlock_shared(); }
+				rw_spinlock&	_l;
+			};
+
+			typedef std::lock_guard<rw_spinlock>	Write_guard;
+
+			Shard&			_at(size_type i) { return *reinterpret_cast<Shard*>(&_shards[i]); }
+			const Shard&	_at(size_type i) const { return *reinterpret_cast<const Shard*>(&_shards[i]); }
+			Shard&			_shard(const key_type& k) { return _at(_part(k) % Shards); }
+			const Shard&	_shard(const key_type& k) const { return _at(_part(k) % Shards); }
+
+		public:
+			explicit concurrent_map(const Compare& comp = Compare(), const Partition& part = Partition(),
+				const allocator_type& alloc = allocator_type()) : _part(part) {
+				size_type	i = 0;
+
+				try {
+					for (; i < Shards; ++i)
+						::new(static_cast<void*>(&_shards[i])) Shard(comp, alloc);
+				}
+				catch (...) {
+					while (i > 0)
+						_at(--i).~Shard();
+					throw ;
+				}
+			}
+
+			concurrent_map(const concurrent_map&) = delete;
+			concurrent_map&	operator=(const concurrent_map&) = delete;
+
+			~concurrent_map() {
+				for (size_type i = 0; i < Shards; ++i)
+					_at(i).~Shard();
+			}
+
+			size_type	shard_count() const { return Shards; }
+
+			// Sum of the shard sizes, each read under its lock.
+			size_type	size() const {
+				size_type	n = 0;
+
+				for (size_type i = 0; i < Shards; ++i) {
+					Read_guard	g(_at(i).lock);
+					n += _at(i).map.size();
+				}
+				return n;
+			}
+
+			bool	empty() const { return size() == 0; }
+
+			// Calls fn(const mapped_type&) under the shard read lock if k is
+			// present. fn must not call back into the map.
+			template <typename Fn>
+			bool	find_and_apply(const key_type& k, Fn fn) const {
+				const Shard&	s = _shard(k);
+				Read_guard		g(s.lock);
+				typename shard_type::const_iterator	it = s.map.find(k);
+
+				if (it == s.map.end())
+					return false;
+				fn(it->second);
+				return true;
+			}
+
+			bool	contains(const key_type& k) const {
+				const Shard&	s = _shard(k);
+				Read_guard		g(s.lock);
+
+				return s.map.find(k) != s.map.end();
+			}
+
+			// Copies the value of k into out, returns false when absent.
+			bool	get(const key_type& k, mapped_type& out) const {
+				const Shard&	s = _shard(k);
+				Read_guard		g(s.lock);
+				typename shard_type::const_iterator	it = s.map.find(k);
+
+				if (it == s.map.end())
+					return false;
+				out = it->second;
+				return true;
+			}
+
+			// Inserts (k, val) if k is absent, returns whether it did.
+			bool	insert(const key_type& k, const mapped_type& val) {
+				Shard&		s = _shard(k);
+				Write_guard	g(s.lock);
+
+				return s.map.insert(value_type(k, val)).second;
+			}
+
+			// Inserts (k, val) if k is absent, else calls fn(mapped_type&) on
+			// the current value under the shard write lock. Returns true on
+			// insertion.
+			template <typename Fn>
+			bool	insert_or_update(const key_type& k, const mapped_type& val, Fn fn) {
+				Shard&		s = _shard(k);
+				Write_guard	g(s.lock);
+				typename shard_type::iterator	it = s.map.lower_bound(k);
+
+				if (it == s.map.end() || s.map.key_comp()(k, it->first)) {
+					s.map.insert(it, value_type(k, val));
+					return true;
+				}
+				fn(it->second);
+				return false;
+			}
+
+			// Inserts or overwrites, returns true on insertion.
+			bool	insert_or_assign(const key_type& k, const mapped_type& val) {
+				return insert_or_update(k, val, Assign(val));
+			}
+
+			size_type	erase(const key_type& k) {
+				Shard&		s = _shard(k);
+				Write_guard	g(s.lock);
+
+				return s.map.erase(k);
+			}
+
+			void	clear() {
+				for (size_type i = 0; i < Shards; ++i) {
+					Write_guard	g(_at(i).lock);
+					_at(i).map.clear();
+				}
+			}
+
+			// Visits shard 0 to Shards - 1, each one in key order and under
+			// its read lock: every shard is seen consistent, the whole map is
+			// not frozen. fn(const value_type&) must not call back into the map.
+			template <typename Fn>
+			void	for_each(Fn fn) const {
+				for (size_type i = 0; i < Shards; ++i) {
+					Read_guard	g(_at(i).lock);
+					for (typename shard_type::const_iterator it = _at(i).map.begin(); it != _at(i).map.end(); ++it)
+						fn(*it);
+				}
+			}
+
+			// Copies every entry to out with the same ordering as for_each(),
+			// so the caller can walk the copy without holding any lock.
+			template <typename OutputIterator>
+			OutputIterator	snapshot(OutputIterator out) const {
+				for (size_type i = 0; i < Shards; ++i) {
+					Read_guard	g(_at(i).lock);
+					for (typename shard_type::const_iterator it = _at(i).map.begin(); it != _at(i).map.end(); ++it, ++out)
+						*out = *it;
+				}
+				return out;
+			}
+
+		private:
+			struct	Assign {
+				explicit Assign(const mapped_type& v) : _v(v) {}
+				void	operator()(mapped_type& x) const { x = _v; }
+				const mapped_type&	_v;
+			};
+
+			Partition	_part;
+			typename std::aligned_storage<sizeof(Shard), alignof(Shard)>::type	_shards[Shards];
+	};
+
+}//namespace
+
+#endif
@@ -0,0 +1,181 @@
+#pragma once
+# ifndef CONCURRENT_STACK_HPP
+# define CONCURRENT_STACK_HPP
+
+# include <memory>
+# include <new>
+# include <utility>
+# include <type_traits>
+# include "concurrent_base.hpp"
+
+namespace ft {
+
+	// Lock-free LIFO (Treiber stack). Nodes come from chunks owned by the
+	// stack and go back to an internal free list, never to the allocator,
+	// so a node read by a late popper is always valid memory. The top
+	// pointers carry a 16 bit version in their unused high bits, bumped by
+	// every successful CAS, which defeats ABA when a node is recycled.
+	// A chunk the allocator places above 48 bits (5 level paging, tagged
+	// pointers) cannot be packed: _get_node() hands it back and throws
+	// std::bad_alloc rather than corrupt the stack.
+	template <typename T, typename Alloc = std::allocator<T> >
+	class	concurrent_stack {
+
+		public:
+			typedef T			value_type;
+			typedef size_t		size_type;
+			typedef Alloc		allocator_type;
+
+		private:
+			struct	Node {
+				std::atomic<Node*>	next;
+				typename std::aligned_storage<sizeof(T), alignof(T)>::type	storage;
+
+				T*	value() { return reinterpret_cast<T*>(&storage); }
+			};
+
+			typedef typename std::allocator_traits<Alloc>::template rebind_alloc<Node>	Node_allocator;
+			typedef std::allocator_traits<Node_allocator>								Node_traits;
+			typedef std::atomic<uintptr_t>												Tagged;
+
+			static_assert(sizeof(void*) == 8, "concurrent_stack packs a version in 64 bit pointers");
+
+			enum { chunk_nodes = 64, ptr_bits = 48 };
+
+			static Node*	_ptr(uintptr_t v) { return reinterpret_cast<Node*>(v & ((uintptr_t(1) << ptr_bits) - 1)); }
+
+			static uintptr_t	_next_tag(uintptr_t old, Node* p)
+			{ return reinterpret_cast<uintptr_t>(p) | ((old >> ptr_bits) + 1) << ptr_bits; }
+
+			// Links [first, last] on top of the list held by top.
+			static void	_push_chain(Tagged& top, Node* first, Node* last) {
+				uintptr_t	old = top.load(std::memory_order_relaxed);
+
+				do {
+					last->next.store(_ptr(old), std::memory_order_relaxed);
+				} while (!top.compare_exchange_weak(old, _next_tag(old, first),
+					std::memory_order_release, std::memory_order_relaxed));
+			}
+
+			static Node*	_pop_node(Tagged& top) {
+				uintptr_t	old = top.load(std::memory_order_acquire);
+				Node*		node;
+
+				do {
+					node = _ptr(old);
+					if (node == 0)
+						return 0;
+				} while (!top.compare_exchange_weak(old,
+					_next_tag(old, node->next.load(std::memory_order_relaxed)),
+					std::memory_order_acquire, std::memory_order_acquire));
+				return node;
+			}
+
+			Node*	_get_node() {
+				Node*	node = _pop_node(_free.value);
+
+				if (node == 0) {
+					// node 0 of a chunk only links the chunk list
+					Node*	chunk = Node_traits::allocate(_node_alloc, chunk_nodes);
+
+					if ((reinterpret_cast<uintptr_t>(chunk + chunk_nodes) - 1) >> ptr_bits) {
+						Node_traits::deallocate(_node_alloc, chunk, chunk_nodes);
+						throw std::bad_alloc();
+					}
+					for (size_type i = 0; i < chunk_nodes; ++i)
+						::new(static_cast<void*>(&chunk[i].next)) std::atomic<Node*>(&chunk[i + 1]);
+					Node*	old = _chunks.load(std::memory_order_relaxed);
+					do {
+						chunk[0].next.store(old, std::memory_order_relaxed);
+					} while (!_chunks.compare_exchange_weak(old, chunk, std::memory_order_release, std::memory_order_relaxed));
+					node = &chunk[1];
+					if (chunk_nodes > 2)
+						_push_chain(_free.value, &chunk[2], &chunk[chunk_nodes - 1]);
+				}
+				return node;
+			}
+
+		public:
+			explicit concurrent_stack(const allocator_type& alloc = allocator_type())
+			: _node_alloc(alloc), _chunks(0) {}
+
+			concurrent_stack(const concurrent_stack&) = delete;
+			concurrent_stack&	operator=(const concurrent_stack&) = delete;
+
+			~concurrent_stack() {
+				for (Node* n = _ptr(_head.value.load(std::memory_order_relaxed)); n != 0;
+					n = n->next.load(std::memory_order_relaxed))
+					n->value()->~T();
+				Node*	chunk = _chunks.load(std::memory_order_relaxed);
+				while (chunk != 0) {
+					Node*	next = chunk[0].next.load(std::memory_order_relaxed);
+					Node_traits::deallocate(_node_alloc, chunk, chunk_nodes);
+					chunk = next;
+				}
+			}
+
+			// Racy by nature, only a hint under concurrency.
+			bool	empty() const { return _ptr(_head.value.load(std::memory_order_acquire)) == 0; }
+
+			void	push(const value_type& val) { _emplace(val); }
+			void	push(value_type&& val) { _emplace(std::move(val)); }
+
+			bool	try_pop(value_type& out) {
+				Node*	node = _pop_node(_head.value);
+
+				if (node == 0)
+					return false;
+				out = std::move(*node->value());
+				node->value()->~T();
+				_push_chain(_free.value, node, node);
+				return true;
+			}
+
+			// Detaches the whole stack with one exchange, then moves the
+			// values to out top first and recycles the nodes with one CAS.
+			template <typename OutputIterator>
+			size_type	pop_all(OutputIterator out) {
+				uintptr_t	cur = _head.value.load(std::memory_order_relaxed);
+
+				while (!_head.value.compare_exchange_weak(cur, _next_tag(cur, 0),
+					std::memory_order_acquire, std::memory_order_relaxed))
+					;
+				Node*		first = _ptr(cur);
+				Node*		last = 0;
+				size_type	n = 0;
+
+				for (Node* node = first; node != 0; node = node->next.load(std::memory_order_relaxed), ++n) {
+					*out = std::move(*node->value());
+					++out;
+					node->value()->~T();
+					last = node;
+				}
+				if (first != 0)
+					_push_chain(_free.value, first, last);
+				return n;
+			}
+
+		private:
+			template <typename U>
+			void	_emplace(U&& val) {
+				Node*	node = _get_node();
+
+				try {
+					::new(static_cast<void*>(node->value())) T(std::forward<U>(val));
+				}
+				catch (...) {
+					_push_chain(_free.value, node, node);
+					throw ;
+				}
+				_push_chain(_head.value, node, node);
+			}
+
+			Node_allocator			_node_alloc;
+			std::atomic<Node*>		_chunks;
+			cache_padded<Tagged>	_head;
+			cache_padded<Tagged>	_free;
+	};
+
+}//namespace
+
+#endif
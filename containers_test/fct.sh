@@ -14,9 +14,14 @@ tested_path="../"
 incl_path="$tested_path"
 srcs="srcs"
 
-CC="clang++"
+CC="${CXX:-c++}"
 CFLAGS="-Wall -Werror -Wextra --std=c++98"
 
+# namespace of the ft build, map, set, map_ext and map_threaded also run as
+# ft_splay and ft_avl, see srcs/policies.hpp
+ft_ns="ft"
+policies=(ft_splay ft_avl)
+
 if false; then
 	CFLAGS+="-fsanitize=address -g3"
 fi
@@ -39,7 +44,8 @@ printf "\e[0;1;94m\
 
 compile () {
 	# 1=file 2=define used {ft/std} 3=output_file 4=compile_log
-	$CC $CFLAGS -o "$3" -I./$incl_path -DTESTED_NAMESPACE=$2 $1 &>$4
+	# a CFLAGS file next to the tests adds its flags, e.g. a later --std
+	$CC $CFLAGS $(cat "$(dirname $1)/CFLAGS" 2>/dev/null) -o "$3" -I./$incl_path -DTESTED_NAMESPACE=$2 $1 &>$4
 	return $?
 }
 
@@ -106,7 +112,7 @@ cmp_one () {
 	std_bin="std.$container.out"; std_log="$logdir/std.$testname.$container.log"
 	std_compile_log="std.$testname.$container.compile.log"
 
-	compile "$1" "ft"  "$ft_bin" /dev/null;  ft_ret=$?
+	compile "$1" "$ft_ns"  "$ft_bin" /dev/null;  ft_ret=$?
 	compile "$1" "std" "$std_bin" $std_compile_log; std_ret=$?
 	same_compilation=$(isEq $ft_ret $std_ret)
 	std_compile=$std_ret
@@ -152,7 +158,7 @@ do_test () {
 
 function main () {
 	pheader
-	containers=(vector map stack set)
+	containers=(vector list map stack queue priority_queue circular_buffer spsc_queue mpmc_queue concurrent_stack concurrent_map read_mostly_map cow_vector cow_map set map_ext map_threaded deferred_clear persistent_map frozen learned_map static_map)
 	# containers=(vector list map stack queue deque multimap set multiset)
 	if [ $# -ne 0 ]; then
 		containers=($@);
@@ -162,4 +168,11 @@ function main () {
 		printf "%40s\n" $container
 		do_test $container 2>/dev/null
 	done
+	for ns in ${policies[@]}; do
+		for container in ${containers[@]}; do
+			[[ "$container" == "map" || "$container" == "set" || "$container" == "map_ext" || "$container" == "map_threaded" ]] || continue
+			printf "%40s\n" "$container ($ns)"
+			ft_ns=$ns do_test $container 2>/dev/null
+		done
+	done
 }
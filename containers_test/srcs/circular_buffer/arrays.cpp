@@ -0,0 +1,53 @@
+#include "common.hpp"
+
+#define TESTED_TYPE int
+
+typedef _cbuf<TESTED_TYPE>	cbuf;
+
+// The two arrays and copy_out hold the contents oldest first, wherever the
+// live range starts in the ring.
+void	printArrays(cbuf const &buf)
+{
+	cbuf::const_array_range	one = buf.array_one();
+	cbuf::const_array_range	two = buf.array_two();
+	TESTED_TYPE				out[16];
+	TESTED_TYPE				*end = buf.copy_out(out);
+
+	std::cout << "arrays (" << one.second + two.second << "):";
+	for (size_t i = 0; i < one.second; ++i)
+		std::cout << " " << one.first[i];
+	for (size_t i = 0; i < two.second; ++i)
+		std::cout << " " << two.first[i];
+	std::cout << " | copy_out (" << end - out << "):";
+	for (TESTED_TYPE *p = out; p != end; ++p)
+		std::cout << " " << *p;
+	std::cout << std::endl;
+}
+
+int		main(void)
+{
+	cbuf	buf(8);
+
+	printArrays(buf);
+	for (int i = 0; i < 24; ++i)
+	{
+		buf.push_back(i);
+		printArrays(buf);
+	}
+	for (int i = 0; i < 5; ++i)
+	{
+		buf.pop_front();
+		printArrays(buf);
+	}
+	for (int i = 0; i < 6; ++i)
+	{
+		buf.push_front(100 + i);
+		printArrays(buf);
+	}
+	while (!buf.empty())
+	{
+		buf.pop_back();
+		printArrays(buf);
+	}
+	return (0);
+}
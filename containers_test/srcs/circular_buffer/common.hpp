@@ -0,0 +1,118 @@
+#include "circular_buffer.hpp"
+#include <deque>
+#include <vector>
+#include <stdexcept>
+#include <iostream>
+#include <string>
+
+#ifndef TESTED_NAMESPACE
+# define TESTED_NAMESPACE ft
+#endif
+
+// There is no std::circular_buffer: the std build runs the tests on this
+// model, a std::deque trimmed to the capacity after every push. Its two
+// arrays are one copy of the contents, the tests only print them joined.
+namespace model {
+	template <typename T>
+	class circular_buffer {
+		public:
+			typedef std::deque<T>								deque_type;
+			typedef T											value_type;
+			typedef typename deque_type::size_type				size_type;
+			typedef typename deque_type::iterator				iterator;
+			typedef typename deque_type::const_iterator			const_iterator;
+			typedef typename deque_type::reverse_iterator		reverse_iterator;
+			typedef typename deque_type::const_reverse_iterator	const_reverse_iterator;
+			typedef std::pair<const T *, size_type>				const_array_range;
+
+			explicit circular_buffer(size_type capacity = 0) : _cap(capacity) { };
+
+			iterator				begin(void) { return _d.begin(); };
+			const_iterator			begin(void) const { return _d.begin(); };
+			iterator				end(void) { return _d.end(); };
+			const_iterator			end(void) const { return _d.end(); };
+			const_reverse_iterator	rbegin(void) const { return _d.rbegin(); };
+			const_reverse_iterator	rend(void) const { return _d.rend(); };
+
+			bool		empty(void) const { return _d.empty(); };
+			bool		full(void) const { return _d.size() == _cap; };
+			size_type	size(void) const { return _d.size(); };
+			size_type	capacity(void) const { return _cap; };
+
+			T		&operator[](size_type n) { return _d[n]; };
+			T		&at(size_type n) { return _d.at(n); };
+			T		&front(void) { return _d.front(); };
+			T		&back(void) { return _d.back(); };
+
+			const_array_range	array_one(void) const {
+				_flat.assign(_d.begin(), _d.end());
+				return const_array_range(_flat.empty() ? 0 : &_flat[0], _flat.size());
+			};
+			const_array_range	array_two(void) const { return const_array_range(0, 0); };
+			template <typename It>
+			It	copy_out(It out) const { return std::copy(_d.begin(), _d.end(), out); };
+
+			void	push_back(T const &val) {
+				if (_cap == 0)
+					return ;
+				if (_d.size() == _cap)
+					_d.pop_front();
+				_d.push_back(val);
+			};
+			void	push_front(T const &val) {
+				if (_cap == 0)
+					return ;
+				if (_d.size() == _cap)
+					_d.pop_back();
+				_d.push_front(val);
+			};
+			void	pop_back(void) { _d.pop_back(); };
+			void	pop_front(void) { _d.pop_front(); };
+			void	clear(void) { _d.clear(); };
+			void	swap(circular_buffer &x) { _d.swap(x._d); std::swap(_cap, x._cap); };
+
+			bool	operator==(circular_buffer const &x) const { return _d == x._d; };
+			bool	operator!=(circular_buffer const &x) const { return _d != x._d; };
+			bool	operator<(circular_buffer const &x) const { return _d < x._d; };
+			bool	operator<=(circular_buffer const &x) const { return _d <= x._d; };
+			bool	operator>(circular_buffer const &x) const { return _d > x._d; };
+			bool	operator>=(circular_buffer const &x) const { return _d >= x._d; };
+
+		private:
+			deque_type				_d;
+			size_type				_cap;
+			mutable std::vector<T>	_flat;
+	};
+
+	template <typename T>
+	void	swap(circular_buffer<T> &x, circular_buffer<T> &y) { x.swap(y); }
+}
+
+#define _ns_ft ft
+#define _ns_std model
+#define _cat(a, b) a ## b
+#define _xcat(a, b) _cat(a, b)
+#define _cbuf _xcat(_ns_, TESTED_NAMESPACE)::circular_buffer
+
+template <typename T_BUF>
+void	printSize(T_BUF const &buf, bool print_content = 1)
+{
+	std::cout << "size: " << buf.size() << " | capacity: " << buf.capacity()
+		<< " | empty: " << buf.empty() << " | full: " << buf.full() << std::endl;
+	if (print_content)
+	{
+		typename T_BUF::const_iterator it = buf.begin(), ite = buf.end();
+		std::cout << "Content is:";
+		for (; it != ite; ++it)
+			std::cout << " " << *it;
+		std::cout << std::endl;
+	}
+	std::cout << "###############################################" << std::endl;
+}
+
+// Deterministic in both builds.
+inline unsigned long	lcg(unsigned long &seed)
+{
+	seed = seed * 6364136223846793005UL + 1442695040888963407UL;
+	return (seed >> 33);
+}
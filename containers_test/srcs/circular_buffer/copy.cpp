@@ -0,0 +1,52 @@
+#include "common.hpp"
+
+#define TESTED_TYPE std::string
+
+typedef _cbuf<TESTED_TYPE>	cbuf;
+
+void	fill(cbuf &buf, int n, char c)
+{
+	for (int i = 0; i < n; ++i)
+		buf.push_back(std::string(i % 3 + 1, c + i));
+}
+
+int		main(void)
+{
+	cbuf	a(5);
+	cbuf	b(5);
+	cbuf	c(3);
+
+	fill(a, 9, 'a');
+	fill(b, 4, 'k');
+	fill(c, 2, 'x');
+
+	// wrapped source, copies keep the capacity
+	cbuf	d(a);
+	printSize(d);
+	d.push_back("new");
+	printSize(d);
+	printSize(a);
+
+	// same capacity reuses the storage, another one swaps in a copy
+	b = a;
+	printSize(b);
+	c = a;
+	printSize(c);
+	c = c;
+	printSize(c);
+	cbuf	e;
+	e = a;
+	printSize(e);
+	a = cbuf(2);
+	printSize(a);
+
+	std::cout << "== " << (b == c) << " != " << (b != d) << " < " << (b < d)
+		<< " <= " << (d <= b) << " > " << (d > b) << " >= " << (b >= c) << std::endl;
+	b.swap(d);
+	printSize(b);
+	printSize(d);
+	swap(a, b);
+	printSize(a);
+	printSize(b);
+	return (0);
+}
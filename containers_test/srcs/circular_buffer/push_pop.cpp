@@ -0,0 +1,62 @@
+#include "common.hpp"
+
+#define TESTED_TYPE int
+
+typedef _cbuf<TESTED_TYPE>	cbuf;
+
+// Random pushes and pops at both ends, the full buffer overwriting the
+// opposite end, for a few capacities.
+void	run(size_t capacity)
+{
+	unsigned long	seed = 5 + capacity;
+	cbuf			buf(capacity);
+
+	for (int i = 0; i < 3000; ++i)
+	{
+		TESTED_TYPE	v = lcg(seed) % 100;
+
+		switch (lcg(seed) % 5)
+		{
+			case 0: case 1: buf.push_back(v); break;
+			case 2: buf.push_front(v); break;
+			case 3: if (!buf.empty()) buf.pop_back(); break;
+			default: if (!buf.empty()) buf.pop_front(); break;
+		}
+		if (i % 600 == 0)
+			printSize(buf);
+	}
+	printSize(buf);
+	if (!buf.empty())
+	{
+		std::cout << "front " << buf.front() << " back " << buf.back()
+			<< " [size / 2] " << buf[buf.size() / 2] << std::endl;
+		buf.front() = -1;
+		buf.back() = -2;
+		buf.at(0) += 10;
+	}
+	try {
+		std::cout << buf.at(buf.size()) << std::endl;
+	}
+	catch (std::out_of_range &) {
+		std::cout << "out_of_range" << std::endl;
+	}
+	std::cout << "reverse:";
+	for (cbuf::const_reverse_iterator it = buf.rbegin(); it != buf.rend(); ++it)
+		std::cout << " " << *it;
+	std::cout << std::endl;
+	buf.clear();
+	printSize(buf);
+	for (int i = 0; i < 20; ++i)
+		buf.push_front(i);
+	printSize(buf);
+}
+
+int		main(void)
+{
+	run(0);
+	run(1);
+	run(2);
+	run(7);
+	run(64);
+	return (0);
+}
@@ -0,0 +1,56 @@
+#include "common.hpp"
+
+// Copies throw once the fuse runs out; live counts the values alive.
+class bomb {
+	public:
+		static int	live;
+		static int	fuse;
+
+		bomb(int v = 0) : value(v) { ++live; };
+		bomb(bomb const &src) : value(src.value) {
+			if (fuse >= 0 && fuse-- == 0)
+				throw std::runtime_error("bomb");
+			++live;
+		};
+		~bomb(void) { --live; };
+		bomb &operator=(bomb const &src) { value = src.value; return *this; };
+
+		int	value;
+};
+
+int	bomb::live = 0;
+int	bomb::fuse = -1;
+
+typedef _cbuf<bomb>	cbuf;
+
+int		main(void)
+{
+	cbuf	src(6);
+	cbuf	dst(4);
+
+	for (int i = 0; i < 9; ++i)
+		src.push_back(bomb(i));
+	std::cout << "live: " << bomb::live << std::endl;
+	for (int fuse = 0; fuse <= 6; fuse += 2)
+	{
+		bomb::fuse = fuse;
+		try {
+			cbuf	copy(src);
+			std::cout << "copy " << fuse << ": built " << copy.size() << std::endl;
+		}
+		catch (std::runtime_error &e) {
+			std::cout << "copy " << fuse << ": " << e.what() << std::endl;
+		}
+		bomb::fuse = fuse;
+		try {
+			dst = src;
+			std::cout << "assign " << fuse << ": built " << dst.size() << std::endl;
+		}
+		catch (std::runtime_error &e) {
+			std::cout << "assign " << fuse << ": " << e.what() << " size " << dst.size() << std::endl;
+		}
+		bomb::fuse = -1;
+		std::cout << "live: " << bomb::live << std::endl;
+	}
+	return (0);
+}
@@ -0,0 +1,129 @@
+#include "concurrent_map.hpp"
+#include <map>
+#include <vector>
+#include <algorithm>
+#include <mutex>
+#include <thread>
+#include <iostream>
+#include <string>
+
+#ifndef TESTED_NAMESPACE
+# define TESTED_NAMESPACE ft
+#endif
+
+// There is no std::concurrent_map: the std build runs the tests on this
+// model, one std::map per shard picked by the same Partition, all behind
+// a single mutex, so that for_each() and snapshot() keep the shard order.
+namespace model {
+	template <typename Key, typename T, typename Compare = std::less<Key>, size_t Shards = 16,
+			typename Partition = ft::hash_partition<Key> >
+	class concurrent_map {
+		public:
+			typedef Key							key_type;
+			typedef T							mapped_type;
+			typedef std::pair<const Key, T>		value_type;
+			typedef size_t						size_type;
+
+		private:
+			typedef std::map<Key, T, Compare>	shard_type;
+			typedef std::lock_guard<std::mutex>	guard;
+
+			shard_type	&_shard(key_type const &k) const { return _shards[_part(k) % Shards]; }
+
+		public:
+			explicit concurrent_map(Compare const &comp = Compare(), Partition const &part = Partition())
+			: _part(part) {
+				for (size_type i = 0; i < Shards; ++i)
+					_shards[i] = shard_type(comp);
+			};
+
+			size_type	shard_count(void) const { return Shards; };
+			size_type	size(void) const {
+				guard		g(_m);
+				size_type	n = 0;
+
+				for (size_type i = 0; i < Shards; ++i)
+					n += _shards[i].size();
+				return n;
+			};
+			bool	empty(void) const { return size() == 0; };
+
+			template <typename Fn>
+			bool	find_and_apply(key_type const &k, Fn fn) const {
+				guard	g(_m);
+				typename shard_type::const_iterator	it = _shard(k).find(k);
+
+				if (it == _shard(k).end())
+					return false;
+				fn(it->second);
+				return true;
+			};
+			bool	contains(key_type const &k) const {
+				guard	g(_m);
+				return _shard(k).count(k) != 0;
+			};
+			bool	get(key_type const &k, mapped_type &out) const {
+				return find_and_apply(k, [&out](mapped_type const &v) { out = v; });
+			};
+			bool	insert(key_type const &k, mapped_type const &val) {
+				guard	g(_m);
+				return _shard(k).insert(value_type(k, val)).second;
+			};
+			template <typename Fn>
+			bool	insert_or_update(key_type const &k, mapped_type const &val, Fn fn) {
+				guard	g(_m);
+				typename shard_type::iterator	it = _shard(k).find(k);
+
+				if (it == _shard(k).end())
+				{
+					_shard(k).insert(value_type(k, val));
+					return true;
+				}
+				fn(it->second);
+				return false;
+			};
+			bool	insert_or_assign(key_type const &k, mapped_type const &val) {
+				return insert_or_update(k, val, [&val](mapped_type &x) { x = val; });
+			};
+			size_type	erase(key_type const &k) {
+				guard	g(_m);
+				return _shard(k).erase(k);
+			};
+			void	clear(void) {
+				guard	g(_m);
+				for (size_type i = 0; i < Shards; ++i)
+					_shards[i].clear();
+			};
+			template <typename Fn>
+			void	for_each(Fn fn) const {
+				guard	g(_m);
+				for (size_type i = 0; i < Shards; ++i)
+					for (typename shard_type::const_iterator it = _shards[i].begin(); it != _shards[i].end(); ++it)
+						fn(*it);
+			};
+			template <typename It>
+			It	snapshot(It out) const {
+				guard	g(_m);
+				for (size_type i = 0; i < Shards; ++i)
+					for (typename shard_type::const_iterator it = _shards[i].begin(); it != _shards[i].end(); ++it, ++out)
+						*out = *it;
+				return out;
+			};
+
+		private:
+			Partition			_part;
+			mutable shard_type	_shards[Shards];
+			mutable std::mutex	_m;
+	};
+}
+
+#define _ns_ft ft
+#define _ns_std model
+#define _cat(a, b) a ## b
+#define _xcat(a, b) _cat(a, b)
+#define _cmap _xcat(_ns_, TESTED_NAMESPACE)::concurrent_map
+
+// Range partition: shard k / 100, so shards come out in key order.
+struct by_hundreds {
+	size_t	operator()(int k) const { return static_cast<size_t>(k) / 100; };
+};
@@ -0,0 +1,76 @@
+#include "common.hpp"
+
+typedef _cmap<int, std::string>							hashed;
+typedef _cmap<int, std::string, std::less<int>, 4, by_hundreds>	ranged;
+
+template <typename Map>
+void	printMap(Map const &m, bool sort)
+{
+	std::vector<std::pair<int, std::string> >	v;
+
+	m.for_each([&v](typename Map::value_type const &x) { v.push_back(std::make_pair(x.first, x.second)); });
+	if (sort)
+		std::sort(v.begin(), v.end());
+	std::cout << "size " << m.size() << ", empty " << m.empty() << ":";
+	for (size_t i = 0; i < v.size(); ++i)
+		std::cout << " " << v[i].first << "=" << v[i].second;
+	std::cout << std::endl;
+}
+
+template <typename Map>
+void	run(bool sort)
+{
+	Map			m;
+	std::string	s;
+
+	std::cout << "shards " << m.shard_count() << std::endl;
+	printMap(m, sort);
+	for (int i = 0; i < 40; ++i)
+		m.insert((i * 37) % 400, std::to_string(i));
+	std::cout << "insert again: " << m.insert(0, "x") << std::endl;
+	printMap(m, sort);
+
+	std::cout << "contains 37: " << m.contains(37) << ", contains 38: " << m.contains(38) << std::endl;
+	std::cout << "get 74: " << m.get(74, s) << " " << s << ", get 75: " << m.get(75, s) << " " << s << std::endl;
+	for (int k = 111; k < 113; ++k)
+	{
+		std::cout << "find_and_apply " << k << ": ";
+		bool	found = m.find_and_apply(k, [](std::string const &v) { std::cout << "[" << v << "] "; });
+		std::cout << found << std::endl;
+	}
+
+	for (int i = 0; i < 60; i += 3)
+	{
+		bool	ins = m.insert_or_update(i, "new", [](std::string &v) { v += "+"; });
+		bool	asg = m.insert_or_assign(i + 1, "set");
+
+		std::cout << ins << asg;
+	}
+	std::cout << std::endl;
+	printMap(m, sort);
+
+	size_t	erased = 0;
+	for (int i = 0; i < 400; i += 2)
+		erased += m.erase(i);
+	std::cout << "erased " << erased << std::endl;
+	printMap(m, sort);
+
+	std::vector<typename Map::value_type>	snap;
+	m.snapshot(std::back_inserter(snap));
+	std::cout << "snapshot " << snap.size() << ":";
+	for (size_t i = 0; i < snap.size(); i += 5)
+		std::cout << " " << snap[i].first;
+	std::cout << std::endl;
+
+	m.clear();
+	printMap(m, sort);
+}
+
+int		main(void)
+{
+	// hashed shards order is the partition's: compare sorted
+	run<hashed>(true);
+	// range shards come out in key order
+	run<ranged>(false);
+	return (0);
+}
@@ -0,0 +1,55 @@
+#include "common.hpp"
+
+typedef _cmap<int, long>	map;
+
+const int	threads_n = 4;
+const int	rounds = 20000;
+const int	keys = 64;
+
+// Every thread bumps the shared counters 0..keys-1 through
+// insert_or_update, and churns keys of its own with insert / get / erase
+// while readers walk the map: the counters end at threads_n * rounds
+// in total, the private keys at what each thread left.
+int		main(void)
+{
+	map							m;
+	std::vector<std::thread>	threads;
+
+	for (int t = 0; t < threads_n; ++t)
+		threads.push_back(std::thread([&m, t]() {
+			long	v;
+
+			for (int i = 0; i < rounds; ++i)
+			{
+				const int	own = 1000 + t * 1000 + i % 500;
+
+				m.insert_or_update((i * 7 + t) % keys, 1, [](long &x) { ++x; });
+				if (!m.insert(own, i))
+				{
+					if (!m.get(own, v) || (i % 3 == 0 && m.erase(own) != 1))
+						std::cout << "lost key " << own << std::endl;
+				}
+				if (i % 1000 == 0)
+				{
+					long	sum = 0;
+
+					m.for_each([&sum](map::value_type const &x) { sum += x.first < keys; });
+					std::this_thread::yield();
+				}
+			}
+		}));
+	for (size_t i = 0; i < threads.size(); ++i)
+		threads[i].join();
+
+	long	counters = 0;
+	size_t	own = 0;
+
+	m.for_each([&](map::value_type const &x) {
+		if (x.first < keys)
+			counters += x.second;
+		else
+			++own;
+	});
+	std::cout << "counters " << counters << ", own keys " << own << ", size " << m.size() << std::endl;
+	return (0);
+}
@@ -0,0 +1,63 @@
+#include "concurrent_stack.hpp"
+#include <vector>
+#include <mutex>
+#include <thread>
+#include <iostream>
+#include <string>
+
+#ifndef TESTED_NAMESPACE
+# define TESTED_NAMESPACE ft
+#endif
+
+// There is no std::concurrent_stack: the std build runs the tests on this
+// model, a std::vector behind a mutex.
+namespace model {
+	template <typename T>
+	class concurrent_stack {
+		public:
+			typedef T		value_type;
+			typedef size_t	size_type;
+
+			bool	empty(void) const {
+				std::lock_guard<std::mutex>	lock(_m);
+				return _v.empty();
+			};
+			void	push(T const &val) {
+				std::lock_guard<std::mutex>	lock(_m);
+				_v.push_back(val);
+			};
+			void	push(T &&val) {
+				std::lock_guard<std::mutex>	lock(_m);
+				_v.push_back(std::move(val));
+			};
+			bool	try_pop(T &out) {
+				std::lock_guard<std::mutex>	lock(_m);
+				if (_v.empty())
+					return false;
+				out = std::move(_v.back());
+				_v.pop_back();
+				return true;
+			};
+			template <typename It>
+			size_type	pop_all(It out) {
+				std::vector<T>	all;
+				{
+					std::lock_guard<std::mutex>	lock(_m);
+					all.swap(_v);
+				}
+				for (size_type i = all.size(); i > 0; --i, ++out)
+					*out = std::move(all[i - 1]);
+				return all.size();
+			};
+
+		private:
+			std::vector<T>		_v;
+			mutable std::mutex	_m;
+	};
+}
+
+#define _ns_ft ft
+#define _ns_std model
+#define _cat(a, b) a ## b
+#define _xcat(a, b) _cat(a, b)
+#define _cstack _xcat(_ns_, TESTED_NAMESPACE)::concurrent_stack
@@ -0,0 +1,60 @@
+#include "common.hpp"
+#include <list>
+#include <iterator>
+
+#define TESTED_TYPE std::string
+
+typedef _cstack<TESTED_TYPE>	stack;
+
+int		main(void)
+{
+	stack			st;
+	TESTED_TYPE		s;
+
+	std::cout << "empty: " << st.empty() << ", try_pop: " << st.try_pop(s) << std::endl;
+	for (int i = 0; i < 5; ++i)
+	{
+		TESTED_TYPE	tmp(i + 1, 'a' + i);
+
+		if (i % 2)
+			st.push(tmp);
+		else
+			st.push(std::move(tmp));
+	}
+	std::cout << "empty: " << st.empty() << std::endl;
+	while (st.try_pop(s))
+		std::cout << s << " ";
+	std::cout << "| empty: " << st.empty() << std::endl;
+
+	// pop_all hands the values top first, through any output iterator
+	std::list<TESTED_TYPE>	out;
+
+	std::cout << "pop_all on empty: " << st.pop_all(std::back_inserter(out)) << std::endl;
+	for (int i = 0; i < 7; ++i)
+		st.push(std::to_string(i));
+	std::cout << "pop_all: " << st.pop_all(std::back_inserter(out)) << ", empty: " << st.empty() << std::endl;
+	for (std::list<TESTED_TYPE>::iterator it = out.begin(); it != out.end(); ++it)
+		std::cout << *it << " ";
+	std::cout << std::endl;
+
+	// grows past several chunks, then reuses the recycled nodes
+	for (int round = 0; round < 4; ++round)
+	{
+		size_t	sum = 0;
+		int		n = 0;
+
+		for (int i = 0; i < 300 * (round + 1); ++i)
+			st.push(std::to_string(i));
+		for (int i = 0; i < 100 && st.try_pop(s); ++i, ++n)
+			sum += std::stoul(s);
+		std::vector<TESTED_TYPE>	rest;
+		n += st.pop_all(std::back_inserter(rest));
+		for (size_t i = 0; i < rest.size(); ++i)
+			sum += std::stoul(rest[i]);
+		std::cout << "round " << round << ": popped " << n << ", sum " << sum
+			<< ", first rest " << rest.front() << ", empty: " << st.empty() << std::endl;
+	}
+	for (int i = 0; i < 10; ++i)
+		st.push("left for the destructor");
+	return (0);
+}
@@ -0,0 +1,66 @@
+#include "common.hpp"
+#include <atomic>
+
+#define TESTED_TYPE unsigned long
+
+typedef _cstack<TESTED_TYPE>	stack;
+
+const int			producers = 3;
+const int			consumers = 3;
+const TESTED_TYPE	per_producer = 20000;
+
+// Producers push 1..per_producer, consumers take them with try_pop or
+// pop_all (one in four rounds, for the 2nd consumer) until all are
+// popped; the totals show every value was popped once.
+int		main(void)
+{
+	stack						st;
+	std::vector<std::thread>	threads;
+	std::atomic<TESTED_TYPE>	popped(0);
+	TESTED_TYPE					sums[consumers] = {};
+	const TESTED_TYPE			total = producers * per_producer;
+
+	for (int p = 0; p < producers; ++p)
+		threads.push_back(std::thread([&st]() {
+			for (TESTED_TYPE i = 1; i <= per_producer; ++i)
+			{
+				st.push(i);
+				if (i % 64 == 0)
+					std::this_thread::yield();
+			}
+		}));
+	for (int c = 0; c < consumers; ++c)
+		threads.push_back(std::thread([&, c]() {
+			std::vector<TESTED_TYPE>	out;
+			TESTED_TYPE					v;
+			unsigned					round = 0;
+
+			while (popped.load() < total)
+			{
+				size_t	got = 0;
+
+				out.clear();
+				if (c == 1 && round++ % 4 == 0)
+					got = st.pop_all(std::back_inserter(out));
+				else if (st.try_pop(v))
+				{
+					out.push_back(v);
+					got = 1;
+				}
+				if (got == 0)
+					std::this_thread::yield();
+				for (size_t k = 0; k < got; ++k)
+					sums[c] += out[k];
+				popped += got;
+			}
+		}));
+	for (size_t i = 0; i < threads.size(); ++i)
+		threads[i].join();
+
+	TESTED_TYPE	sum = 0;
+
+	for (int c = 0; c < consumers; ++c)
+		sum += sums[c];
+	std::cout << "popped " << popped.load() << ", sum " << sum << ", empty " << st.empty() << std::endl;
+	return (0);
+}
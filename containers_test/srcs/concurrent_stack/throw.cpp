@@ -0,0 +1,70 @@
+#include "common.hpp"
+#include <stdexcept>
+
+// Copies throw once the fuse runs out; live counts the values alive.
+class bomb {
+	public:
+		static int	live;
+		static int	fuse;
+
+		bomb(int v = 0) : value(v) { ++live; };
+		bomb(bomb const &src) : value(src.value) { _light(); ++live; };
+		bomb(bomb &&src) : value(src.value) { ++live; };
+		~bomb(void) { --live; };
+		bomb &operator=(bomb const &src) { value = src.value; return *this; };
+		bomb &operator=(bomb &&src) { value = src.value; return *this; };
+
+		int	value;
+
+	private:
+		static void	_light(void) {
+			if (fuse >= 0 && fuse-- == 0)
+				throw std::runtime_error("bomb");
+		};
+};
+
+int	bomb::live = 0;
+int	bomb::fuse = -1;
+
+typedef _cstack<bomb>	stack;
+
+int		main(void)
+{
+	{
+		stack	st;
+
+		// a throwing copy leaves the stack as it was, and its node reusable
+		for (int i = 0; i < 200; ++i)
+		{
+			bomb	b(i);
+
+			bomb::fuse = i % 3 == 0 ? 0 : -1;
+			try {
+				st.push(b);
+			}
+			catch (std::runtime_error &e) {
+				if (i % 30 == 0)
+					std::cout << "push " << i << ": " << e.what() << std::endl;
+			}
+		}
+		bomb::fuse = -1;
+		std::cout << "live: " << bomb::live << std::endl;
+
+		bomb	out;
+		int		n = 0;
+		long	sum = 0;
+
+		while (st.try_pop(out))
+		{
+			if (n++ % 20 == 0)
+				std::cout << out.value << " ";
+			sum += out.value;
+		}
+		std::cout << "| popped " << n << ", sum " << sum << ", live: " << bomb::live << std::endl;
+		for (int i = 0; i < 50; ++i)
+			st.push(bomb(i));
+		std::cout << "live: " << bomb::live << std::endl;
+	}
+	std::cout << "after destructor, live: " << bomb::live << std::endl;
+	return (0);
+}
@@ -0,0 +1,43 @@
+#include "cow_map.hpp"
+#include <map>
+#include <iostream>
+#include <string>
+
+#ifndef TESTED_NAMESPACE
+# define TESTED_NAMESPACE ft
+#endif
+
+#define _pair TESTED_NAMESPACE::pair
+
+// There is no std::cow_map: the std build runs the tests on this model,
+// a std::map that every copy duplicates. A cow_map must be
+// indistinguishable from it.
+namespace model {
+	template <typename Key, typename T>
+	class cow_map : public std::map<Key, T> {
+		public:
+			typedef std::map<Key, T>	map_type;
+
+			cow_map(void) { };
+			template <typename It>
+			cow_map(It first, It last) : map_type(first, last) { };
+			explicit cow_map(map_type const &x) : map_type(x) { };
+
+			map_type const	&base(void) const { return *this; };
+	};
+}
+
+#define _ns_ft ft
+#define _ns_std model
+#define _cat(a, b) a ## b
+#define _xcat(a, b) _cat(a, b)
+#define _cmap _xcat(_ns_, TESTED_NAMESPACE)::cow_map
+
+template <typename Map>
+void	printMap(char const *name, Map const &mp)
+{
+	std::cout << name << " size " << mp.size() << ", empty " << mp.empty() << ":";
+	for (typename Map::const_iterator it = mp.begin(); it != mp.end(); ++it)
+		std::cout << " " << it->first << "=" << it->second;
+	std::cout << std::endl;
+}
@@ -0,0 +1,68 @@
+#include "common.hpp"
+
+typedef _cmap<int, int>	map;
+
+// A reference or iterator taken from a copy keeps writing to that copy
+// only: copies made while it is alive must not see the writes.
+int		main(void)
+{
+	map		a;
+
+	for (int i = 0; i < 6; ++i)
+		a[i] = i * 10;
+
+	int				&ref = a[2];
+	map::iterator	it = a.find(4);
+	map				b(a);
+	map				c;
+
+	c = a;
+	ref = -2;
+	it->second = -4;
+	a.begin()->second = -100;
+	printMap("a", a);
+	printMap("b", b);
+	printMap("c", c);
+
+	// a copy taken from a shared map detaches before handing out a
+	// reference
+	map		d(b);
+	int		&dref = d[5];
+
+	dref = 55;
+	printMap("b", b);
+	printMap("d", d);
+
+	// reading through a const reference hands nothing out
+	map const	&cb = b;
+	map			e(cb);
+	int			sum = 0;
+
+	for (map::const_iterator cit = cb.begin(); cit != cb.end(); ++cit)
+		sum += cit->second;
+	e[sum] = cb.find(1)->second + cb.lower_bound(2)->second + (int)cb.count(3);
+	printMap("b", b);
+	printMap("e", e);
+
+	// clear() drops the escaped references, later copies share again
+	a.clear();
+	a[7] = 7;
+	map	f(a);
+	f[7] = 8;
+	printMap("a", a);
+	printMap("f", f);
+
+	// the iterators of a non-const begin() / end() stay valid while the
+	// map is copied
+	map::iterator	first = b.begin();
+	map::iterator	last = b.end();
+	map				g(b);
+
+	for (; first != last; ++first)
+		first->second *= 2;
+	for (map::reverse_iterator rit = g.rbegin(); rit != g.rend(); ++rit)
+		rit->second += 1;
+	printMap("b", b);
+	printMap("g", g);
+	return (0);
+}
@@ -0,0 +1,64 @@
+#include "common.hpp"
+
+typedef _cmap<int, std::string>	map;
+
+void	printAll(map const &a, map const &b, map const &c)
+{
+	printMap("a", a);
+	printMap("b", b);
+	printMap("c", c);
+	std::cout << "a == b " << (a == b) << ", a < c " << (a < c) << ", b >= c " << (b >= c) << std::endl;
+	std::cout << "###############################################" << std::endl;
+}
+
+// Copies share the tree until one writes: every modifier on one copy must
+// leave the others as they were.
+int		main(void)
+{
+	_pair<const int, std::string>	init[] = {
+		_pair<const int, std::string>(3, "three"), _pair<const int, std::string>(1, "one"),
+		_pair<const int, std::string>(4, "four"), _pair<const int, std::string>(5, "five"),
+		_pair<const int, std::string>(9, "nine")
+	};
+	map	a(init, init + 5);
+	map	b(a);
+	map	c;
+
+	c = b;
+	printAll(a, b, c);
+
+	b.insert(_pair<const int, std::string>(2, "two"));
+	c[1] = "ONE";
+	c[7] = "seven";
+	printAll(a, b, c);
+
+	b = a;
+	c = a;
+	a.insert(a.begin(), _pair<const int, std::string>(0, "zero"));
+	b.insert(init, init + 2);
+	c.erase(4);
+	printAll(a, b, c);
+
+	b = a;
+	c = a;
+	a.erase(a.begin());
+	b.erase(b.find(3), b.end());
+	c.lower_bound(4)->second = "lower";
+	c.upper_bound(4)->second = "upper";
+	c.equal_range(9).first->second = "range";
+	printAll(a, b, c);
+
+	b = a;
+	c = a;
+	a.clear();
+	b.swap(a);
+	b[42] = "after swap";
+	swap(c, a);
+	printAll(a, b, c);
+
+	map	d(c.base());
+	d.erase(d.begin()->first);
+	printAll(d, c, b);
+	std::cout << "count " << c.count(3) << d.count(1) << ", find " << (c.find(8) == c.end()) << std::endl;
+	return (0);
+}
@@ -0,0 +1,43 @@
+#include "cow_vector.hpp"
+#include <vector>
+#include <iostream>
+#include <string>
+
+#ifndef TESTED_NAMESPACE
+# define TESTED_NAMESPACE ft
+#endif
+
+// There is no std::cow_vector: the std build runs the tests on this
+// model, a std::vector that every copy duplicates. A cow_vector must be
+// indistinguishable from it.
+namespace model {
+	template <typename T>
+	class cow_vector : public std::vector<T> {
+		public:
+			typedef std::vector<T>					vector_type;
+			typedef typename vector_type::size_type	size_type;
+
+			cow_vector(void) { };
+			explicit cow_vector(size_type n, T const &val = T()) : vector_type(n, val) { };
+			template <typename It>
+			cow_vector(It first, It last) : vector_type(first, last) { };
+			explicit cow_vector(vector_type const &x) : vector_type(x) { };
+
+			vector_type const	&base(void) const { return *this; };
+	};
+}
+
+#define _ns_ft ft
+#define _ns_std model
+#define _cat(a, b) a ## b
+#define _xcat(a, b) _cat(a, b)
+#define _cvec _xcat(_ns_, TESTED_NAMESPACE)::cow_vector
+
+template <typename Vec>
+void	printVec(char const *name, Vec const &vct)
+{
+	std::cout << name << " size " << vct.size() << ", empty " << vct.empty() << ":";
+	for (typename Vec::const_iterator it = vct.begin(); it != vct.end(); ++it)
+		std::cout << " " << *it;
+	std::cout << std::endl;
+}
@@ -0,0 +1,72 @@
+#include "common.hpp"
+
+#define TESTED_TYPE int
+
+typedef _cvec<TESTED_TYPE>	vector;
+
+// A reference or iterator taken from a copy keeps writing to that copy
+// only: copies made while it is alive must not see the writes.
+int		main(void)
+{
+	vector				a;
+
+	for (int i = 0; i < 6; ++i)
+		a.push_back(i);
+
+	TESTED_TYPE			&ref = a[1];
+	vector::iterator	it = a.begin() + 3;
+	vector				b(a);
+	vector				c;
+
+	c = a;
+	ref = 100;
+	*it = 300;
+	it[2] = 500;
+	printVec("a", a);
+	printVec("b", b);
+	printVec("c", c);
+
+	// a copy taken from a shared vector detaches before handing out a
+	// reference
+	vector		d(b);
+	TESTED_TYPE	&dref = d.back();
+
+	dref = -1;
+	printVec("b", b);
+	printVec("d", d);
+
+	// reading through a const reference hands nothing out
+	vector const	&cb = b;
+	vector			e(cb);
+	TESTED_TYPE		sum = 0;
+
+	for (vector::const_iterator cit = cb.begin(); cit != cb.end(); ++cit)
+		sum += *cit;
+	e.push_back(sum + cb[0] + cb.at(1) + cb.front() + cb.back());
+	printVec("b", b);
+	printVec("e", e);
+
+	// clear() drops the escaped references, later copies share again
+	a.clear();
+	a.push_back(7);
+	vector	f(a);
+	f[0] = 8;
+	printVec("a", a);
+	printVec("f", f);
+
+	// the iterators of a non-const begin() / end() stay valid while the
+	// vector is copied
+	vector::iterator	first = b.begin();
+	vector::iterator	last = b.end();
+	vector				g(b);
+
+	for (; first != last; ++first)
+		*first *= 2;
+	printVec("b", b);
+	printVec("g", g);
+	for (vector::reverse_iterator rit = g.rbegin(); rit != g.rend(); ++rit)
+		*rit += 1;
+	printVec("b", b);
+	printVec("g", g);
+	return (0);
+}
@@ -0,0 +1,80 @@
+#include "common.hpp"
+
+#define TESTED_TYPE std::string
+
+typedef _cvec<TESTED_TYPE>	vector;
+
+void	printAll(vector const &a, vector const &b, vector const &c)
+{
+	printVec("a", a);
+	printVec("b", b);
+	printVec("c", c);
+	std::cout << "a == b " << (a == b) << ", a < c " << (a < c) << ", b >= c " << (b >= c) << std::endl;
+	std::cout << "###############################################" << std::endl;
+}
+
+// Copies share the elements until one writes: every modifier on one copy
+// must leave the others as they were.
+int		main(void)
+{
+	TESTED_TYPE	init[] = { "zero", "one", "two", "three", "four" };
+	vector		a(init, init + 5);
+	vector		b(a);
+	vector		c;
+
+	c = b;
+	printAll(a, b, c);
+
+	b.push_back("five");
+	c[0] = "ZERO";
+	printAll(a, b, c);
+
+	a = b;
+	c = b;
+	a.pop_back();
+	b.resize(8, "pad");
+	c.reserve(100);
+	printAll(a, b, c);
+
+	c = a;
+	b = a;
+	a.insert(a.begin() + 1, "ins");
+	b.insert(b.end(), 2, "two more");
+	c.insert(c.begin(), init, init + 2);
+	printAll(a, b, c);
+
+	b = a;
+	c = a;
+	a.erase(a.begin());
+	b.erase(b.begin() + 1, b.end() - 1);
+	c.at(2) = "at";
+	c.front() = "front";
+	c.back() = "back";
+	printAll(a, b, c);
+
+	b = a;
+	c = a;
+	a.assign(3, "same");
+	b.assign(init + 2, init + 4);
+	c.clear();
+	printAll(a, b, c);
+
+	b = a;
+	a.swap(c);
+	c.push_back("after swap");
+	swap(a, b);
+	printAll(a, b, c);
+
+	vector	d(a);
+	vector	e(10, "e");
+
+	d = e;
+	e.clear();
+	d[9] = "nine";
+	printAll(d, e, a);
+
+	vector	f(a.base());
+	f.push_back("from base");
+	printAll(f, a, b);
+	return (0);
+}
@@ -0,0 +1,57 @@
+#include "reclaimer.hpp"
+#include "vector.hpp"
+#include "list.hpp"
+#include "map.hpp"
+#include "set.hpp"
+#include <vector>
+#include <list>
+#include <map>
+#include <set>
+#include <atomic>
+#include <iostream>
+#include <string>
+
+#ifndef TESTED_NAMESPACE
+# define TESTED_NAMESPACE ft
+#endif
+
+// The std build clears in place: once flushed, a deferred_clear() must
+// not be told apart from clear().
+namespace model {
+	using namespace std;
+
+	template <typename Container>
+	void	deferred_clear(Container &c) { c.clear(); }
+
+	struct Reclaimer {
+		static Reclaimer	&instance(void) { static Reclaimer r; return r; };
+		void				flush(void) { };
+	};
+}
+
+#define _ns_ft ft
+#define _ns_std model
+#define _cat(a, b) a ## b
+#define _xcat(a, b) _cat(a, b)
+#define _ns _xcat(_ns_, TESTED_NAMESPACE)
+
+// live counts the values alive, on any thread. The header node of an ft
+// tree holds a default-built value: those are not counted.
+struct counted {
+	static std::atomic<int>	live;
+
+	counted(void) : value(-1) { };
+	counted(int v) : value(v) { ++live; };
+	counted(counted const &src) : value(src.value) { live += value != -1; };
+	~counted(void) { live -= value != -1; };
+	counted &operator=(counted const &src) {
+		live += (src.value != -1) - (value != -1);
+		value = src.value;
+		return *this;
+	};
+	bool	operator<(counted const &rhs) const { return value < rhs.value; };
+
+	int	value;
+};
+
+std::atomic<int>	counted::live(0);
@@ -0,0 +1,66 @@
+#include "common.hpp"
+#include <functional>
+
+template <typename C>
+void	printSeq(char const *name, C const &c)
+{
+	std::cout << name << " size " << c.size() << ":";
+	for (typename C::const_iterator it = c.begin(); it != c.end(); ++it)
+		std::cout << " " << it->value;
+	std::cout << std::endl;
+}
+
+template <typename C>
+void	printMap(char const *name, C const &c)
+{
+	std::cout << name << " size " << c.size() << ":";
+	for (typename C::const_iterator it = c.begin(); it != c.end(); ++it)
+		std::cout << " " << it->first << "=" << it->second.value;
+	std::cout << std::endl;
+}
+
+// Every container is emptied at once, stays usable with its comparator,
+// and the reclaimer destroys every element it took.
+int		main(void)
+{
+	_ns::vector<counted>								vct;
+	_ns::list<counted>									lst;
+	_ns::map<int, counted, std::greater<int> >			mp;
+	_ns::set<counted>									st;
+
+	for (int round = 0; round < 3; ++round)
+	{
+		for (int i = 0; i < 1000 * (round + 1); ++i)
+		{
+			vct.push_back(counted(i));
+			lst.push_front(counted(i));
+			mp.insert(_ns::make_pair(i, counted(i)));
+			st.insert(counted(i));
+		}
+		_ns::Reclaimer::instance().flush();
+		std::cout << "round " << round << ", live " << counted::live << std::endl;
+		_ns::deferred_clear(vct);
+		_ns::deferred_clear(lst);
+		_ns::deferred_clear(mp);
+		_ns::deferred_clear(st);
+		std::cout << "sizes " << vct.size() << lst.size() << mp.size() << st.size()
+			<< ", empty " << vct.empty() << lst.empty() << mp.empty() << st.empty() << std::endl;
+
+		for (int i = 0; i < 4; ++i)
+		{
+			vct.push_back(counted(i));
+			lst.push_back(counted(i));
+			mp[i] = counted(i * 10);
+			st.insert(counted(3 - i));
+		}
+		printSeq("vector", vct);
+		printSeq("list", lst);
+		printMap("map", mp);
+		printSeq("set", st);
+		_ns::deferred_clear(vct);
+		_ns::deferred_clear(vct);
+		_ns::Reclaimer::instance().flush();
+		std::cout << "flushed, live " << counted::live << std::endl;
+	}
+	return (0);
+}
@@ -0,0 +1,41 @@
+#include "common.hpp"
+
+// Ascending inserts leave a splay tree as one path of n nodes: freeing
+// it, on the reclaimer thread or here, must not recurse along it.
+
+template <typename Map>
+void	fill(Map &mp, int n)
+{
+	for (int i = 0; i < n; ++i)
+		mp.insert(mp.end(), _ns::make_pair(i, counted(i)));
+}
+
+#define _splay_map(ns) _xcat(_splay_map_, ns)
+#define _splay_map_ft ft::map<int, counted, ft::less<int>, std::allocator<ft::pair<const int, counted> >, ft::Rb_no_cache, ft::Splay_balance>
+#define _splay_map_std std::map<int, counted>
+
+typedef _splay_map(TESTED_NAMESPACE)	map;
+
+int		main(void)
+{
+	const int	n = 300000;
+
+	{
+		map	mp;
+
+		fill(mp, n);
+		std::cout << "size " << mp.size() << ", live " << counted::live << std::endl;
+		_ns::deferred_clear(mp);
+		_ns::Reclaimer::instance().flush();
+		std::cout << "deferred, live " << counted::live << std::endl;
+
+		fill(mp, n);
+		mp.clear();
+		std::cout << "cleared, live " << counted::live << std::endl;
+
+		fill(mp, n);
+		std::cout << "size " << mp.size() << ", live " << counted::live << std::endl;
+	}
+	std::cout << "destroyed, live " << counted::live << std::endl;
+	return (0);
+}
@@ -0,0 +1,36 @@
+#include "common.hpp"
+
+#define T1 int
+
+typedef _fset<T1>	fset;
+
+// For every size up to 300, keys 1, 3, ..., 2n - 1 are searched with every
+// value from -1 to 2n + 1: each key, each gap, and both sides of the range.
+int		main(void)
+{
+	std::vector<T1>	keys;
+
+	for (int n = 0; n <= 300; ++n)
+	{
+		fset			st(keys.begin(), keys.end());
+		unsigned long	h = 0;
+
+		for (T1 k = -1; k <= 2 * n + 1; ++k)
+		{
+			h = h * 31 + at_or_end(st, st.lower_bound(k)) + 1;
+			h = h * 31 + at_or_end(st, st.upper_bound(k)) + 1;
+			h = h * 31 + st.rank(k);
+			h = h * 31 + st.count(k);
+		}
+		std::cout << "n " << n << ": size " << st.size() << " | searches " << h;
+		if (n < 10)
+		{
+			std::cout << " | lower_bound(" << n << ") " << at_or_end(st, st.lower_bound(n));
+			std::cout << " | upper_bound(" << n << ") " << at_or_end(st, st.upper_bound(n));
+			std::cout << " | rank(" << n << ") " << st.rank(n);
+		}
+		std::cout << std::endl;
+		keys.push_back(2 * n + 1);
+	}
+	return (0);
+}
@@ -0,0 +1,91 @@
+#include "frozen_map.hpp"
+#include "frozen_set.hpp"
+#include <algorithm>
+#include <iostream>
+#include <map>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#ifndef TESTED_NAMESPACE
+# define TESTED_NAMESPACE ft
+#endif
+
+#define _pair TESTED_NAMESPACE::pair
+
+// There is no std::frozen_set nor std::frozen_map: the std build runs the
+// tests on these models, sorted vectors searched with std::lower_bound.
+namespace model {
+	template <typename Key>
+	class frozen_set {
+		public:
+			typedef std::vector<Key>							vector_type;
+			typedef typename vector_type::size_type				size_type;
+			typedef typename vector_type::const_iterator		const_iterator;
+			typedef typename vector_type::const_reverse_iterator	const_reverse_iterator;
+
+			frozen_set(void) { };
+			template <typename It>
+			frozen_set(It first, It last) : _v(first, last) { };
+
+			const_iterator			begin(void) const { return _v.begin(); };
+			const_iterator			end(void) const { return _v.end(); };
+			const_reverse_iterator	rbegin(void) const { return _v.rbegin(); };
+			const_reverse_iterator	rend(void) const { return _v.rend(); };
+			size_type				size(void) const { return _v.size(); };
+			bool					empty(void) const { return _v.empty(); };
+
+			const_iterator	lower_bound(Key const &k) const { return std::lower_bound(_v.begin(), _v.end(), k); };
+			const_iterator	upper_bound(Key const &k) const { return std::upper_bound(_v.begin(), _v.end(), k); };
+			size_type		rank(Key const &k) const { return lower_bound(k) - _v.begin(); };
+			bool			contains(Key const &k) const { return find(k) != end(); };
+			size_type		count(Key const &k) const { return contains(k); };
+			const_iterator	find(Key const &k) const {
+				const_iterator	it = lower_bound(k);
+				return (it == end() || k < *it) ? end() : it;
+			};
+
+		private:
+			vector_type	_v;
+	};
+
+	template <typename Key, typename T>
+	class frozen_map {
+		public:
+			typedef std::map<Key, T>					map_type;
+			typedef typename map_type::size_type		size_type;
+			typedef typename map_type::const_iterator	const_iterator;
+
+			frozen_map(void) { };
+			template <typename It>
+			frozen_map(It first, It last) : _m(first, last) { };
+
+			const_iterator	begin(void) const { return _m.begin(); };
+			const_iterator	end(void) const { return _m.end(); };
+			size_type		size(void) const { return _m.size(); };
+			T const			&at(Key const &k) const { return _m.at(k); };
+			const_iterator	find(Key const &k) const { return _m.find(k); };
+			size_type		count(Key const &k) const { return _m.count(k); };
+			const_iterator	lower_bound(Key const &k) const { return _m.lower_bound(k); };
+			const_iterator	upper_bound(Key const &k) const { return _m.upper_bound(k); };
+			size_type		rank(Key const &k) const { return std::distance(_m.begin(), _m.lower_bound(k)); };
+
+		private:
+			map_type	_m;
+	};
+}
+
+#define _ns_ft ft
+#define _ns_std model
+#define _cat(a, b) a ## b
+#define _xcat(a, b) _cat(a, b)
+#define _fset _xcat(_ns_, TESTED_NAMESPACE)::frozen_set
+#define _fmap _xcat(_ns_, TESTED_NAMESPACE)::frozen_map
+
+// Value under it, -1 at end().
+template <typename C, typename It>
+long	at_or_end(C const &c, It it)
+{
+	return (it == c.end() ? -1 : (long)*it);
+}
@@ -0,0 +1,31 @@
+#include "common.hpp"
+
+#define T1 int
+
+typedef _fset<T1>	fset;
+
+// Forward and reverse walks over every size up to 300, and back from end().
+int		main(void)
+{
+	std::vector<T1>	keys;
+
+	for (int n = 0; n <= 300; ++n)
+	{
+		fset			st(keys.begin(), keys.end());
+		unsigned long	fwd = 0, rev = 0, back = 0;
+		int				steps = 0;
+
+		for (fset::const_iterator it = st.begin(); it != st.end(); ++it, ++steps)
+			fwd = fwd * 31 + *it;
+		for (fset::const_reverse_iterator it = st.rbegin(); it != st.rend(); ++it, ++steps)
+			rev = rev * 31 + *it;
+		for (fset::const_iterator it = st.end(); it != st.begin(); ++steps)
+			back = back * 31 + *--it;
+		std::cout << "n " << n << ": " << steps << " steps | " << fwd << " " << rev << " " << back;
+		if (n != 0)
+			std::cout << " | front " << *st.begin() << " back " << *st.rbegin();
+		std::cout << std::endl;
+		keys.push_back(n * 7 % 5 + 5 * n);
+	}
+	return (0);
+}
@@ -0,0 +1,41 @@
+#include "common.hpp"
+
+#define T1 int
+#define T2 std::string
+
+typedef _fmap<T1, T2>	fmap;
+
+int		main(void)
+{
+	std::vector<_pair<const T1, T2> >	items;
+
+	items.push_back(_pair<const T1, T2>(12, "no"));
+	items.push_back(_pair<const T1, T2>(25, "funny"));
+	items.push_back(_pair<const T1, T2>(42, "fgzgxfn"));
+	items.push_back(_pair<const T1, T2>(80, "hey"));
+	items.push_back(_pair<const T1, T2>(90, "8"));
+
+	fmap	mp(items.begin(), items.end());
+
+	for (fmap::const_iterator it = mp.begin(); it != mp.end(); ++it)
+		std::cout << "key: " << it->first << " | value: " << it->second << std::endl;
+	std::cout << "size: " << mp.size() << std::endl;
+	std::cout << "at(42): " << mp.at(42) << std::endl;
+	try {
+		mp.at(43);
+	}
+	catch (std::out_of_range &e) {
+		std::cout << "at(43): out_of_range" << std::endl;
+	}
+	for (T1 k = 0; k < 100; k += 11)
+	{
+		fmap::const_iterator	lo = mp.lower_bound(k), hi = mp.upper_bound(k);
+
+		std::cout << k << ": count " << mp.count(k) << " | rank " << mp.rank(k);
+		std::cout << " | lower_bound " << (lo == mp.end() ? std::string("end") : lo->second);
+		std::cout << " | upper_bound " << (hi == mp.end() ? std::string("end") : hi->second) << std::endl;
+	}
+	std::cout << "find(80): " << mp.find(80)->second << std::endl;
+	std::cout << "find(81) is end: " << (mp.find(81) == mp.end()) << std::endl;
+	return (0);
+}
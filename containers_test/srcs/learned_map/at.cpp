@@ -0,0 +1,46 @@
+#include "common.hpp"
+
+#define T1 int
+#define T2 std::string
+
+typedef _lmap<T1, T2>	lmap;
+
+int		main(void)
+{
+	TESTED_NAMESPACE::vector<T1>	keys;
+	TESTED_NAMESPACE::vector<T2>	values;
+
+	{
+		lmap	mp(keys, values);
+
+		std::cout << "empty: " << mp.empty() << " | size " << mp.size();
+		std::cout << " | lower_bound(3) " << mp.lower_bound(3) << " | find(3) " << mp.find(3) << std::endl;
+	}
+	keys.push_back(12); values.push_back("no");
+	keys.push_back(25); values.push_back("funny");
+	keys.push_back(42); values.push_back("fgzgxfn");
+	keys.push_back(80); values.push_back("hey");
+
+	lmap	mp(keys, values, 1, 4);
+
+	std::cout << "max_error " << mp.max_error() << " | size " << mp.size() << std::endl;
+	for (size_t i = 0; i < mp.size(); ++i)
+		std::cout << "key: " << mp.key(i) << " | value: " << mp.value(i) << std::endl;
+	for (T1 k = 0; k <= 90; k += 6)
+		std::cout << k << ": lower_bound " << mp.lower_bound(k) << " | find " << mp.find(k) << " | contains " << mp.contains(k) << std::endl;
+	std::cout << "at(42): " << mp.at(42) << std::endl;
+	try {
+		mp.at(43);
+	}
+	catch (std::out_of_range &e) {
+		std::cout << "at(43): out_of_range" << std::endl;
+	}
+	values.pop_back();
+	try {
+		lmap	bad(keys, values);
+	}
+	catch (std::invalid_argument &e) {
+		std::cout << "size mismatch: invalid_argument" << std::endl;
+	}
+	return (0);
+}
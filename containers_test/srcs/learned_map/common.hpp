@@ -0,0 +1,98 @@
+#include "learned_map.hpp"
+#include <algorithm>
+#include <limits>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#ifndef TESTED_NAMESPACE
+# define TESTED_NAMESPACE ft
+#endif
+
+// There is no std::learned_map: the std build runs the tests on this
+// model, a binary search over the whole key vector.
+namespace model {
+	template <typename Key, typename T>
+	class learned_map {
+		public:
+			typedef size_t	size_type;
+
+			learned_map(std::vector<Key> const &keys, std::vector<T> const &values, size_type max_error = 32, unsigned = 18)
+			: _keys(keys), _values(values), _max_error(max_error) {
+				if (keys.size() != values.size())
+					throw std::invalid_argument("learned_map: keys and values differ in size");
+			};
+
+			bool		empty(void) const { return _keys.empty(); };
+			size_type	size(void) const { return _keys.size(); };
+			size_type	max_error(void) const { return _max_error; };
+			Key const	&key(size_type pos) const { return _keys[pos]; };
+			T const		&value(size_type pos) const { return _values[pos]; };
+			T const		&at(Key const &k) const {
+				if (find(k) == size())
+					throw std::out_of_range("learned_map::at");
+				return _values[find(k)];
+			};
+			size_type	lower_bound(Key const &k) const { return std::lower_bound(_keys.begin(), _keys.end(), k) - _keys.begin(); };
+			size_type	find(Key const &k) const {
+				size_type	pos = lower_bound(k);
+				return (pos == size() || k < _keys[pos]) ? size() : pos;
+			};
+			size_type	count(Key const &k) const { return find(k) != size(); };
+			bool		contains(Key const &k) const { return find(k) != size(); };
+
+		private:
+			std::vector<Key>	_keys;
+			std::vector<T>		_values;
+			size_type			_max_error;
+	};
+}
+
+#define _ns_ft ft
+#define _ns_std model
+#define _cat(a, b) a ## b
+#define _xcat(a, b) _cat(a, b)
+#define _lmap _xcat(_ns_, TESTED_NAMESPACE)::learned_map
+
+// Deterministic in both builds.
+inline unsigned long	lcg(unsigned long &seed)
+{
+	seed = seed * 6364136223846793005UL + 1442695040888963407UL;
+	return (seed >> 11);
+}
+
+// Sorts and dedups raw into keys, values[i] derived from keys[i].
+template <typename Key>
+void	makeKeys(std::vector<Key> raw, TESTED_NAMESPACE::vector<Key> &keys, TESTED_NAMESPACE::vector<int> &values)
+{
+	std::sort(raw.begin(), raw.end());
+	raw.erase(std::unique(raw.begin(), raw.end()), raw.end());
+	keys.assign(raw.begin(), raw.end());
+	values.clear();
+	for (size_t i = 0; i < raw.size(); ++i)
+		values.push_back((int)(i * 7 + 1));
+}
+
+// Digest of lower_bound, find and count on each key, on its neighbours,
+// and on the ends of the key type.
+template <typename Key, typename Map>
+unsigned long	probe(Map const &mp, TESTED_NAMESPACE::vector<Key> const &keys)
+{
+	unsigned long	h = mp.size();
+	Key				lo = std::numeric_limits<Key>::min();
+	Key				hi = std::numeric_limits<Key>::max();
+
+	for (size_t i = 0; i < keys.size(); ++i)
+	{
+		Key		k = keys[i];
+		Key		q[5] = { k, k > lo ? Key(k - 1) : k, k < hi ? Key(k + 1) : k,
+			k > lo + 1 ? Key(k - 2) : k, k < hi - 1 ? Key(k + 2) : k };
+
+		for (int j = 0; j < 5; ++j)
+			h = h * 31 + mp.lower_bound(q[j]) * 3 + mp.find(q[j]) * 5 + mp.count(q[j]);
+	}
+	h = h * 31 + mp.lower_bound(lo) + mp.find(lo) * 3;
+	h = h * 31 + mp.lower_bound(hi) + mp.find(hi) * 3;
+	return (h);
+}
@@ -0,0 +1,64 @@
+#include "common.hpp"
+
+// Keys packed at both ends of their type, with max_error 0: the spline
+// spans the whole range and the window is the predicted slot alone.
+template <typename Key>
+void	ends(char const *name)
+{
+	Key const						lo = std::numeric_limits<Key>::min();
+	Key const						hi = std::numeric_limits<Key>::max();
+	std::vector<Key>				raw;
+	TESTED_NAMESPACE::vector<Key>	keys;
+	TESTED_NAMESPACE::vector<int>	values;
+
+	for (int i = 0; i < 200; ++i)
+	{
+		raw.push_back(Key(lo + i * 3));
+		raw.push_back(Key(hi - i * 5));
+	}
+	raw.push_back(Key(lo / 2 + hi / 2));
+	makeKeys(raw, keys, values);
+
+	_lmap<Key, int>	mp(keys, values, 0, 18);
+
+	std::cout << name << ": size " << mp.size() << " | " << probe(mp, keys);
+	std::cout << " | min at " << mp.at(lo) << " | max at " << mp.at(hi) << std::endl;
+}
+
+// Every value of a small type, then every other one.
+template <typename Key>
+void	full(char const *name)
+{
+	std::vector<Key>				raw;
+	TESTED_NAMESPACE::vector<Key>	keys;
+	TESTED_NAMESPACE::vector<int>	values;
+
+	for (long k = std::numeric_limits<Key>::min(); k <= (long)std::numeric_limits<Key>::max(); ++k)
+		raw.push_back(Key(k));
+	makeKeys(raw, keys, values);
+	_lmap<Key, int>	all(keys, values, 0, 18);
+	std::cout << name << " full: size " << all.size() << " | " << probe(all, keys) << std::endl;
+
+	for (size_t i = 0; i < raw.size(); i += 2)
+		raw[i / 2] = raw[i];
+	raw.resize((raw.size() + 1) / 2);
+	makeKeys(raw, keys, values);
+	_lmap<Key, int>	half(keys, values, 0, 18);
+	std::cout << name << " half: size " << half.size() << " | " << probe(half, keys) << std::endl;
+}
+
+int		main(void)
+{
+	ends<int>("int");
+	ends<unsigned int>("unsigned int");
+	ends<long>("long");
+	ends<unsigned long>("unsigned long");
+	ends<long long>("long long");
+	ends<unsigned long long>("unsigned long long");
+	full<char>("char");
+	full<signed char>("signed char");
+	full<unsigned char>("unsigned char");
+	full<short>("short");
+	full<unsigned short>("unsigned short");
+	return (0);
+}
@@ -0,0 +1,44 @@
+#include "common.hpp"
+
+#define T1 long
+#define T2 int
+
+typedef _lmap<T1, T2>	lmap;
+
+// Uniform, clustered and heavy-tailed keys, under error bounds from zero
+// (no slack around the prediction) to one the window cannot hold.
+int		main(void)
+{
+	size_t const	errors[] = { 0, 1, 4, 32, (size_t)-2, (size_t)-1 };
+	unsigned const	radix[] = { 1, 6, 18 };
+	unsigned long	seed = 42;
+
+	for (int dist = 0; dist < 3; ++dist)
+	{
+		std::vector<T1>					raw;
+		TESTED_NAMESPACE::vector<T1>	keys;
+		TESTED_NAMESPACE::vector<T2>	values;
+
+		for (int i = 0; i < 3000; ++i)
+		{
+			unsigned long	r = lcg(seed);
+
+			if (dist == 0)
+				raw.push_back((T1)(r % 1000000));
+			else if (dist == 1)
+				raw.push_back((T1)((r % 20) * 100000000 + (r >> 20) % 500));
+			else
+				raw.push_back((T1)(r >> (r % 50)) * (r % 2 ? 1 : -1));
+		}
+		makeKeys(raw, keys, values);
+		for (size_t e = 0; e < sizeof(errors) / sizeof(*errors); ++e)
+			for (size_t r = 0; r < sizeof(radix) / sizeof(*radix); ++r)
+			{
+				lmap	mp(keys, values, errors[e], radix[r]);
+
+				std::cout << "dist " << dist << " | max_error " << errors[e] << " | radix " << radix[r];
+				std::cout << " | size " << mp.size() << " | " << probe(mp, keys) << std::endl;
+			}
+	}
+	return (0);
+}
@@ -0,0 +1,81 @@
+#include "common.hpp"
+#include "pool_allocator.hpp"
+
+// ft lists on node pools, std lists on std::allocator: same output
+#define _pool_ft ft::pool_allocator
+#define _pool_std std::allocator
+#define _pool_cat(a, b) a ## b
+#define _pool_xcat(a, b) _pool_cat(a, b)
+#define _pool _pool_xcat(_pool_, TESTED_NAMESPACE)
+
+typedef TESTED_NAMESPACE::list<std::string, _pool<std::string> >	pool_list;
+
+void	printList(pool_list const &lst)
+{
+	std::cout << "size: " << lst.size() << " |";
+	for (pool_list::const_iterator it = lst.begin(); it != lst.end(); ++it)
+		std::cout << " " << *it;
+	std::cout << std::endl;
+}
+
+void	fill(pool_list &lst, int first, int n, int step)
+{
+	for (int i = 0; i < n; ++i)
+		lst.push_back(std::string(1, 'a' + first + i * step));
+}
+
+int		main(void)
+{
+	pool_list	dst;
+
+	// every source lives on its own pool and dies before dst
+	{
+		pool_list	src;
+
+		fill(src, 0, 4, 1);
+		dst.splice(dst.end(), src);
+		printList(dst);
+		printList(src);
+		src.push_back("z");
+	}
+	{
+		pool_list	src;
+
+		fill(src, 10, 5, 1);
+		dst.splice(dst.begin(), src, ++src.begin());
+		dst.splice(dst.end(), src, ++src.begin(), --src.end());
+		printList(dst);
+		printList(src);
+	}
+	dst.sort();
+	{
+		pool_list	src;
+
+		fill(src, 1, 6, 3);
+		dst.merge(src);
+		printList(dst);
+		printList(src);
+	}
+	{
+		pool_list	src;
+
+		fill(src, 20, 3, 1);
+		src.merge(dst);
+		printList(src);
+		dst.swap(src);
+	}
+	printList(dst);
+
+	// lists sharing a pool relink their nodes
+	pool_list			lru(dst.get_allocator());
+	pool_list::iterator	it = dst.begin();
+	std::string const	*node = &*it;
+
+	lru.splice(lru.end(), dst, it);
+	std::cout << "same node: " << (&lru.front() == node) << std::endl;
+	lru.splice(lru.begin(), dst);
+	lru.splice(lru.begin(), lru, --lru.end());
+	printList(lru);
+	printList(dst);
+	return (0);
+}
@@ -0,0 +1,63 @@
+#include "common.hpp"
+#include <stdexcept>
+
+// Copies throw once the fuse runs out; live counts the values alive.
+class bomb {
+	public:
+		static int	live;
+		static int	fuse;
+
+		bomb(int v = 0) : value(v) { ++live; };
+		bomb(bomb const &src) : value(src.value) {
+			if (fuse >= 0 && fuse-- == 0)
+				throw std::runtime_error("bomb");
+			++live;
+		};
+		~bomb(void) { --live; };
+		bomb &operator=(bomb const &src) { value = src.value; return *this; };
+
+		int	value;
+};
+
+int	bomb::live = 0;
+int	bomb::fuse = -1;
+
+#define TESTED_TYPE bomb
+
+template <typename Build>
+void	tryBuild(const char *name, Build build, int fuse)
+{
+	bomb::fuse = fuse;
+	try {
+		build();
+		std::cout << name << ": built" << std::endl;
+	}
+	catch (std::runtime_error &e) {
+		std::cout << name << ": " << e.what() << " after " << fuse << " copies" << std::endl;
+	}
+	bomb::fuse = -1;
+	std::cout << "live: " << bomb::live << std::endl;
+}
+
+TESTED_TYPE						g_val(7);
+TESTED_TYPE						g_arr[5];
+TESTED_NAMESPACE::list<TESTED_TYPE>	*g_src;
+
+void	fill(void) { TESTED_NAMESPACE::list<TESTED_TYPE> lst(5, g_val); }
+void	range(void) { TESTED_NAMESPACE::list<TESTED_TYPE> lst(g_arr, g_arr + 5); }
+void	copy(void) { TESTED_NAMESPACE::list<TESTED_TYPE> lst(*g_src); }
+
+int		main(void)
+{
+	TESTED_NAMESPACE::list<TESTED_TYPE>	src(6, g_val);
+
+	g_src = &src;
+	std::cout << "live: " << bomb::live << std::endl;
+	for (int fuse = 0; fuse <= 6; fuse += 3)
+	{
+		tryBuild("fill", fill, fuse);
+		tryBuild("range", range, fuse);
+		tryBuild("copy", copy, fuse);
+	}
+	return (0);
+}
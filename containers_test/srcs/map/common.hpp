@@ -2,6 +2,7 @@
 #include <map>
 #include <iostream>
 #include <string>
+#include "../policies.hpp"
 
 #ifndef TESTED_NAMESPACE
 # define TESTED_NAMESPACE ft
@@ -0,0 +1,302 @@
+#include "map.hpp"
+#include "set.hpp"
+#include <map>
+#include <set>
+#include <vector>
+#include <iostream>
+#include <string>
+#include <tuple>
+#include "../policies.hpp"
+
+#ifndef TESTED_NAMESPACE
+# define TESTED_NAMESPACE ft
+#endif
+
+// The ft map and set extensions. The std build runs the tests on this
+// model, std::map and std::set with the extensions written the plain way.
+namespace model {
+	// Calls fn on [first, last) until it returns false.
+	template <typename It, typename Fn>
+	bool	visit(It first, It last, Fn &fn)
+	{
+		for (; first != last; ++first)
+			if (!fn(*first))
+				return false;
+		return true;
+	}
+
+	template <typename Key, typename T, typename Compare = std::less<Key> >
+	class map : public std::map<Key, T, Compare> {
+		public:
+			typedef std::map<Key, T, Compare>	base;
+
+			map(void) { };
+			explicit map(Compare const &comp) : base(comp) { };
+			template <typename It>
+			map(It first, It last) : base(first, last) { };
+
+			template <typename It, typename Out>
+			Out	find_many(It first, It last, Out out) {
+				for (; first != last; ++first)
+					*out++ = this->find(*first);
+				return out;
+			};
+			template <typename It, typename Out>
+			Out	find_many(It first, It last, Out out) const {
+				for (; first != last; ++first)
+					*out++ = this->find(*first);
+				return out;
+			};
+			template <typename It, typename Out>
+			Out	contains_many(It first, It last, Out out) const {
+				for (; first != last; ++first)
+					*out++ = this->count(*first) != 0;
+				return out;
+			};
+
+			std::pair<typename base::iterator, bool>	find_or_insert(Key const &k) { return try_emplace(k); };
+			std::pair<typename base::iterator, bool>	insert_or_assign(Key const &k, T const &obj) {
+				typename base::iterator	it = this->lower_bound(k);
+
+				if (it != this->end() && !this->key_comp()(k, it->first))
+				{
+					it->second = obj;
+					return std::make_pair(it, false);
+				}
+				return std::make_pair(this->emplace_hint(it, k, obj), true);
+			};
+			template <typename... Args>
+			std::pair<typename base::iterator, bool>	try_emplace(Key const &k, Args&&... args) {
+				typename base::iterator	it = this->lower_bound(k);
+
+				if (it != this->end() && !this->key_comp()(k, it->first))
+					return std::make_pair(it, false);
+				return std::make_pair(this->emplace_hint(it, std::piecewise_construct,
+					std::forward_as_tuple(k), std::forward_as_tuple(std::forward<Args>(args)...)), true);
+			};
+
+			// Walks from hint, one comparison a step.
+			typename base::const_iterator	lower_bound(typename base::const_iterator hint, Key const &k) const {
+				if (hint != this->end() && this->key_comp()(hint->first, k))
+				{
+					while (hint != this->end() && this->key_comp()(hint->first, k))
+						++hint;
+					return hint;
+				}
+				for (typename base::const_iterator prev = hint; hint != this->begin(); hint = prev)
+					if (this->key_comp()((--prev)->first, k))
+						break ;
+				return hint;
+			};
+			// Erasing an empty range turns a const_iterator into an iterator.
+			typename base::iterator	lower_bound(typename base::const_iterator hint, Key const &k) {
+				return this->erase(hint = static_cast<map const &>(*this).lower_bound(hint, k), hint);
+			};
+			typename base::const_iterator	find(typename base::const_iterator hint, Key const &k) const {
+				hint = lower_bound(hint, k);
+				return hint == this->end() || this->key_comp()(k, hint->first) ? this->end() : hint;
+			};
+			typename base::iterator	find(typename base::const_iterator hint, Key const &k) {
+				return this->erase(hint = static_cast<map const &>(*this).find(hint, k), hint);
+			};
+			using base::lower_bound;
+			using base::find;
+
+			template <typename Fn>
+			bool	for_each(Fn fn) { return visit(this->begin(), this->end(), fn); };
+			template <typename Fn>
+			bool	for_each(Fn fn) const { return visit(this->begin(), this->end(), fn); };
+			template <typename Fn>
+			bool	for_each_in_range(Key const &lo, Key const &hi, Fn fn) {
+				return this->key_comp()(hi, lo) || visit(this->lower_bound(lo), this->upper_bound(hi), fn);
+			};
+			template <typename Fn>
+			bool	for_each_in_range(Key const &lo, Key const &hi, Fn fn) const {
+				return this->key_comp()(hi, lo) || visit(this->lower_bound(lo), this->upper_bound(hi), fn);
+			};
+	};
+
+	template <typename Key, typename Compare = std::less<Key> >
+	class set : public std::set<Key, Compare> {
+		public:
+			typedef std::set<Key, Compare>	base;
+
+			set(void) { };
+			explicit set(Compare const &comp) : base(comp) { };
+			template <typename It>
+			set(It first, It last) : base(first, last) { };
+
+			template <typename It, typename Out>
+			Out	find_many(It first, It last, Out out) const {
+				for (; first != last; ++first)
+					*out++ = this->find(*first);
+				return out;
+			};
+			template <typename It, typename Out>
+			Out	contains_many(It first, It last, Out out) const {
+				for (; first != last; ++first)
+					*out++ = this->count(*first) != 0;
+				return out;
+			};
+
+			typename base::iterator	lower_bound(typename base::iterator hint, Key const &k) const {
+				if (hint != this->end() && this->key_comp()(*hint, k))
+				{
+					while (hint != this->end() && this->key_comp()(*hint, k))
+						++hint;
+					return hint;
+				}
+				for (typename base::iterator prev = hint; hint != this->begin(); hint = prev)
+					if (this->key_comp()(*--prev, k))
+						break ;
+				return hint;
+			};
+			typename base::iterator	find(typename base::iterator hint, Key const &k) const {
+				hint = lower_bound(hint, k);
+				return hint == this->end() || this->key_comp()(k, *hint) ? this->end() : hint;
+			};
+			using base::lower_bound;
+			using base::find;
+
+			template <typename Fn>
+			bool	for_each(Fn fn) const { return visit(this->begin(), this->end(), fn); };
+			template <typename Fn>
+			bool	for_each_in_range(Key const &lo, Key const &hi, Fn fn) const {
+				return this->key_comp()(hi, lo) || visit(this->lower_bound(lo), this->upper_bound(hi), fn);
+			};
+	};
+
+	// A map with a lookup cache: Cache only keeps the slots, filled and
+	// emptied as Rb_tree does. A find or an insertion hits when the slot
+	// of k holds the node of k, a miss that finds k puts it there, and an
+	// erased node leaves its slot.
+	template <typename Key, typename T, typename Cache>
+	class hot_map : public map<Key, T> {
+		public:
+			typedef map<Key, T>					base;
+			typedef typename base::iterator		iterator;
+			typedef typename base::const_iterator	const_iterator;
+			typedef typename base::value_type	value_type;
+			typedef typename base::size_type	size_type;
+
+			Cache const	&lookup_cache(void) const { return _cache; };
+
+			iterator		find(Key const &k) { return _lookup(k); };
+			const_iterator	find(Key const &k) const { return _lookup(k); };
+
+			std::pair<iterator, bool>	insert(value_type const &val) {
+				_lookup(val.first);
+				return base::insert(val);
+			};
+			std::pair<iterator, bool>	insert(value_type &&val) { return insert(static_cast<value_type const &>(val)); };
+			using base::insert;
+			T	&operator[](Key const &k) { return find_or_insert(k).first->second; };
+			std::pair<iterator, bool>	find_or_insert(Key const &k) {
+				_lookup(k);
+				return base::find_or_insert(k);
+			};
+			std::pair<iterator, bool>	insert_or_assign(Key const &k, T const &obj) {
+				_lookup(k);
+				return base::insert_or_assign(k, obj);
+			};
+			template <typename... Args>
+			std::pair<iterator, bool>	try_emplace(Key const &k, Args&&... args) {
+				_lookup(k);
+				return base::try_emplace(k, std::forward<Args>(args)...);
+			};
+
+			void		erase(iterator pos) {
+				_cache.erase(pos->first, &*pos);
+				base::erase(pos);
+			};
+			size_type	erase(Key const &k) {
+				iterator	it = base::find(k);
+
+				if (it == this->end())
+					return (0);
+				erase(it);
+				return (1);
+			};
+			void		erase(iterator first, iterator last) {
+				while (first != last)
+					erase(first++);
+			};
+			void		clear(void) {
+				_cache.clear();
+				base::clear();
+			};
+			void		swap(hot_map &x) {
+				base::swap(x);
+				_cache.swap(x._cache);
+			};
+
+		private:
+			iterator	_lookup(Key const &k) const {
+				iterator	it = const_cast<hot_map &>(*this).base::find(k);
+
+				if (it != this->end() && _cache.get(k) == &*it)
+					++_cache.hits;
+				else
+				{
+					++_cache.misses;
+					if (it != this->end())
+						_cache.put(k, &*it);
+				}
+				return (it);
+			};
+
+			mutable Cache	_cache;
+	};
+}
+
+#define _ns_ft ft
+#define _ns_ft_splay ft_splay
+#define _ns_ft_avl ft_avl
+#define _ns_std model
+#define _cat(a, b) a ## b
+#define _xcat(a, b) _cat(a, b)
+#define _map _xcat(_ns_, TESTED_NAMESPACE)::map
+#define _set _xcat(_ns_, TESTED_NAMESPACE)::set
+#define _pair TESTED_NAMESPACE::pair
+
+// Maps with a lookup cache, on the balancing policy of the build.
+namespace hot_ft {
+	template <typename Key, typename T, typename Cache>
+	using map = ft::map<Key, T, ft::less<Key>, std::allocator<ft::pair<const Key, T> >, Cache, ft::Rb_balance>;
+}
+namespace hot_ft_splay {
+	template <typename Key, typename T, typename Cache>
+	using map = ft::map<Key, T, ft::less<Key>, std::allocator<ft::pair<const Key, T> >, Cache, ft::Splay_balance>;
+}
+namespace hot_ft_avl {
+	template <typename Key, typename T, typename Cache>
+	using map = ft::map<Key, T, ft::less<Key>, std::allocator<ft::pair<const Key, T> >, Cache, ft::Avl_balance>;
+}
+namespace hot_std {
+	template <typename Key, typename T, typename Cache>
+	using map = model::hot_map<Key, T, Cache>;
+}
+#define _hot_map _xcat(hot_, TESTED_NAMESPACE)::map
+
+// Key of a map or set value.
+template <typename P>
+int		key(P const &p) { return p.first; }
+inline int	key(int v) { return v; }
+
+// Order-sensitive digest of a whole container.
+template <typename T_MAP>
+unsigned long	digest(T_MAP const &mp)
+{
+	unsigned long	h = mp.size();
+
+	for (typename T_MAP::const_iterator it = mp.begin(); it != mp.end(); ++it)
+		h = h * 1000003 + (unsigned long)it->first * 31 + it->second.size();
+	return (h);
+}
+
+// Deterministic in both builds.
+inline unsigned long	lcg(unsigned long &seed)
+{
+	seed = seed * 6364136223846793005UL + 1442695040888963407UL;
+	return (seed >> 33);
+}
@@ -0,0 +1,63 @@
+#include "common.hpp"
+
+typedef _map<int, std::string>	map;
+
+void	printMap(char const *name, map const &mp)
+{
+	std::cout << name << " size " << mp.size() << ", digest " << digest(mp);
+	if (!mp.empty())
+		std::cout << ", first " << mp.begin()->first << ", last " << mp.rbegin()->first;
+	std::cout << std::endl;
+}
+
+// Copies are built in one block, over threads from FT_PARALLEL_COPY_MIN
+// nodes (see CFLAGS): each copy must be independent of its source and
+// keep working while its nodes are erased and new ones come in.
+int		main(void)
+{
+	unsigned long	seed = 36;
+	size_t			sizes[] = { 0, 1, 2, 100, 255, 256, 257, 5000 };
+
+	for (size_t s = 0; s < 8; ++s)
+	{
+		map		src;
+
+		while (src.size() < sizes[s])
+		{
+			const int	k = lcg(seed) % (sizes[s] * 4);
+			src[k] = std::string(k % 7, 'a' + k % 26);
+		}
+		map		cpy(src);
+		map		asg;
+
+		asg[-1] = "overwritten";
+		asg = cpy;
+		printMap("src", src);
+		printMap("cpy", cpy);
+		std::cout << "equal " << (src == cpy) << (cpy == asg) << std::endl;
+
+		// erase most of the copy, the block stays for the rest
+		for (int i = 0; !cpy.empty() && i < (int)sizes[s] * 4; i += 3)
+			cpy.erase(i);
+		for (int i = 1; i < 40; i += 2)
+			cpy[i * 1000] = "new";
+		printMap("cpy", cpy);
+		printMap("src", src);
+
+		// a copy of a copy, then the first copy goes away
+		map		*tmp = new map(cpy);
+		map		cc(*tmp);
+
+		delete tmp;
+		cc.erase(cc.begin(), cc.find(5000));
+		printMap("cc", cc);
+
+		// swapped blocks go with their trees
+		asg.swap(cc);
+		asg.clear();
+		printMap("asg", asg);
+		printMap("cc", cc);
+		std::cout << "###############################################" << std::endl;
+	}
+	return (0);
+}
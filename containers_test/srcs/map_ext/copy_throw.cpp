@@ -0,0 +1,72 @@
+#include "common.hpp"
+#include <stdexcept>
+
+// Copies throw once the fuse runs out; live counts the values alive.
+// The header node of an ft tree holds a default-built value: those are
+// not counted.
+class bomb {
+	public:
+		static int	live;
+		static int	fuse;
+
+		bomb(void) : value(-1) { };
+		bomb(int v) : value(v) { ++live; };
+		bomb(bomb const &src) : value(src.value) { _light(); ++live; };
+		~bomb(void) { live -= value != -1; };
+		bomb &operator=(bomb const &src) { value = src.value; return *this; };
+
+		int	value;
+
+	private:
+		static void	_light(void) {
+			if (fuse >= 0 && fuse-- == 0)
+				throw std::runtime_error("bomb");
+		};
+};
+
+int	bomb::live = 0;
+int	bomb::fuse = -1;
+
+typedef _map<int, bomb>	map;
+
+// A copy that throws, serial or parallel, destroys what it built and
+// leaves the target as it was.
+int		main(void)
+{
+	int	sizes[] = { 10, 300, 3000 };
+
+	for (int s = 0; s < 3; ++s)
+	{
+		map	src;
+
+		for (int i = 0; i < sizes[s]; ++i)
+			src.insert(_pair<const int, bomb>(i, bomb(i)));
+		std::cout << "size " << src.size() << ", live " << bomb::live << std::endl;
+		for (int fuse = 0; fuse < sizes[s]; fuse += sizes[s] / 5 + 1)
+		{
+			map	dst;
+
+			dst.insert(_pair<const int, bomb>(-1, bomb(1000)));
+			bomb::fuse = fuse;
+			try {
+				map	cpy(src);
+				std::cout << "no throw" << std::endl;
+			}
+			catch (std::runtime_error &e) {
+				std::cout << "copy: " << e.what() << ", live " << bomb::live;
+			}
+			bomb::fuse = fuse;
+			try {
+				dst = src;
+			}
+			catch (std::runtime_error &e) {
+				std::cout << ", assign: " << e.what() << ", live " << bomb::live << std::endl;
+			}
+			bomb::fuse = -1;
+			dst = src;
+			std::cout << "assign " << dst.size() << ", live " << bomb::live << std::endl;
+		}
+	}
+	std::cout << "live " << bomb::live << std::endl;
+	return (0);
+}
@@ -0,0 +1,80 @@
+#include "common.hpp"
+#include <list>
+
+typedef _map<int, std::string>	map;
+typedef _set<int>				set;
+
+// One result per key, in the order of the keys, for batches around the
+// group size, with keys missing, repeated or out of order.
+template <typename C, typename Keys>
+void	lookups(C &c, Keys const &keys)
+{
+	std::vector<typename C::iterator>	found;
+	bool								present[200];
+	bool								*end = c.contains_many(keys.begin(), keys.end(), present);
+
+	c.find_many(keys.begin(), keys.end(), std::back_inserter(found));
+	std::cout << keys.size() << " keys, " << found.size() << " found, " << (end - present) << " flags:";
+	for (size_t i = 0; i < found.size(); ++i)
+	{
+		if (found[i] == c.end())
+			std::cout << " -";
+		else
+			std::cout << " " << key(*found[i]);
+		std::cout << "/" << present[i];
+	}
+	std::cout << std::endl;
+}
+
+int		main(void)
+{
+	unsigned long		seed = 41;
+	map					mp;
+	set					st;
+	size_t				sizes[] = { 0, 1, 15, 16, 17, 33, 200 };
+
+	for (int i = 0; i < 150; ++i)
+	{
+		const int	k = lcg(seed) % 300;
+
+		mp[k] = std::string(1, 'a' + k % 26);
+		st.insert(k);
+	}
+	for (size_t s = 0; s < 7; ++s)
+	{
+		std::vector<int>	keys;
+		std::list<int>		lkeys;
+
+		for (size_t i = 0; i < sizes[s]; ++i)
+			keys.push_back((int)(lcg(seed) % 320) - 10);
+		if (!keys.empty())
+			keys.back() = keys.front();
+		lkeys.assign(keys.begin(), keys.end());
+		lookups(mp, keys);
+		lookups(st, lkeys);
+	}
+
+	// the iterators are usable, and the const map hands out const ones
+	std::vector<int>				keys;
+	std::vector<map::iterator>		found;
+	std::vector<map::const_iterator>	cfound;
+	map const						&cmp = mp;
+
+	for (map::iterator it = mp.begin(); it != mp.end(); ++it)
+		keys.push_back(it->first);
+	mp.find_many(keys.begin(), keys.end(), std::back_inserter(found));
+	for (size_t i = 0; i < found.size(); ++i)
+		found[i]->second += "!";
+	cmp.find_many(keys.rbegin(), keys.rend(), std::back_inserter(cfound));
+	std::cout << "const:";
+	for (size_t i = 0; i < cfound.size(); i += 10)
+		std::cout << " " << cfound[i]->first << cfound[i]->second;
+	std::cout << std::endl;
+
+	// an empty tree finds nothing
+	map		empty;
+	found.clear();
+	empty.find_many(keys.begin(), keys.begin() + 20, std::back_inserter(found));
+	std::cout << "empty: " << found.size() << " " << (found.back() == empty.end()) << std::endl;
+	return (0);
+}
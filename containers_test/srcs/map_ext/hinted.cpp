@@ -0,0 +1,103 @@
+#include "common.hpp"
+
+typedef ft::counting_compare<ft::less<int>, int>	comp;
+typedef _map<int, int, comp>						map;
+typedef _set<int, comp>								set;
+
+template <typename It, typename End>
+int		at(It it, End end)
+{
+	return (it == end ? -1 : key(*it));
+}
+
+// Hinted lookups from every position answer as the plain ones do, for
+// keys present, missing, and beyond both ends.
+template <typename C, typename Hint>
+void	lookups(C &c, Hint first, Hint last)
+{
+	for (Hint h = first; ; ++h)
+	{
+		std::cout << at(h, last) << ":";
+		for (int k = -2; k <= 2 * (int)c.size() + 2; ++k)
+			std::cout << " " << at(c.find(h, k), c.end()) << "/" << at(c.lower_bound(h, k), c.end());
+		std::cout << std::endl;
+		if (h == last)
+			break ;
+	}
+}
+
+// Inserts from every hint into copies: the result and the contents match
+// those of an unhinted insert.
+template <typename C, typename V>
+void	inserts(C const &src, V (*make)(int))
+{
+	for (int i = 0; i <= (int)src.size(); ++i)
+	{
+		std::cout << "hint " << i << ":";
+		for (int k = -1; k <= 2 * (int)src.size() + 1; ++k)
+		{
+			C							c(src);
+			typename C::iterator		h = c.begin();
+
+			for (int j = 0; j < i; ++j)
+				++h;
+			typename C::iterator		r = c.insert(h, make(k));
+
+			std::cout << " " << key(*r) << "/" << c.size();
+			for (typename C::iterator it = c.begin(); it != c.end(); ++it)
+				std::cout << (it == c.begin() ? "" : ",") << key(*it);
+		}
+		std::cout << std::endl;
+	}
+}
+
+_pair<const int, int>	make_pair(int k) { return (_pair<const int, int>(k, -k)); }
+int						make_int(int k) { return (k); }
+
+// Each lookup starts from the result of the previous one, at most eight
+// keys away: the cost follows the distance, not the size.
+template <typename C, typename Hint>
+void	cost(char const *name, C &c, ft::compare_stats &stats, Hint h)
+{
+	unsigned long	seed = 44;
+	size_t			n = 0;
+
+	stats.calls = 0;
+	for (int k = 0; k < 2 * (int)c.size(); k += 2 + 2 * (lcg(seed) % 3), n += 2)
+	{
+		c.lower_bound(h, k + 1 - 2 * (lcg(seed) % 8));
+		h = c.find(h, k);
+	}
+	std::cout << name << ": " << (double(stats.calls) / n <= 12 ? "within" : "over") << " 12 per lookup, log2(n) is 13" << std::endl;
+}
+
+int		main(void)
+{
+	ft::compare_stats	stats;
+	map					mp((comp(&stats)));
+	set					st((comp(&stats)));
+
+	for (int n = 0; n < 9; ++n)
+	{
+		std::cout << "size " << n << std::endl;
+		lookups(mp, mp.begin(), mp.end());
+		lookups(static_cast<map const &>(mp), mp.begin(), mp.end());
+		lookups(st, st.begin(), st.end());
+		inserts(mp, make_pair);
+		inserts(st, make_int);
+		mp.insert(make_pair(2 * n + 1));
+		st.insert(2 * n + 1);
+	}
+
+	map		big((comp(&stats)));
+	set		bst((comp(&stats)));
+
+	for (int k = 0; k < 2 * 8192; k += 2)
+	{
+		big.insert(big.end(), make_pair(k));
+		bst.insert(bst.end(), k);
+	}
+	cost("map", big, stats, big.begin());
+	cost("set", bst, stats, bst.begin());
+	return (0);
+}
@@ -0,0 +1,117 @@
+#include "common.hpp"
+
+typedef ft::Rb_hot_cache<ft::hash<int>, 2>	small_cache;
+typedef ft::Rb_hot_cache<ft::hash<int>, 8>	cache;
+
+template <typename M>
+void	stats(char const *name, M const &mp)
+{
+	std::cout << name << ": size " << mp.size() << " hits " << mp.lookup_cache().hits
+		<< " misses " << mp.lookup_cache().misses << " |";
+	for (typename M::const_iterator it = mp.begin(); it != mp.end(); ++it)
+		std::cout << " " << it->first << "=" << it->second;
+	std::cout << std::endl;
+}
+
+template <typename M>
+int		at(M const &mp, int k)
+{
+	typename M::const_iterator	it = mp.find(k);
+
+	return (it == mp.end() ? -1 : it->second);
+}
+
+// Skewed keys: the low ones come back most of the time.
+int		hot_key(unsigned long &seed)
+{
+	const unsigned long	r = lcg(seed) % 1024;
+
+	return (r * r * r / (1024 * 1024 * 16));
+}
+
+// Every modifier with a mix of hot and cold keys, so that slots are hit,
+// replaced, and emptied by erasures of their node.
+template <typename M>
+void	run(unsigned long seed)
+{
+	M	mp;
+	M	other;
+
+	for (int i = 0; i < 3000; ++i)
+	{
+		const int	k = hot_key(seed);
+		const int	op = lcg(seed) % 16;
+
+		if (op < 6)
+			std::cout << at(mp, k);
+		else if (op < 8)
+			std::cout << ++mp[k];
+		else if (op == 8)
+			std::cout << mp.insert(_pair<const int, int>(k, i)).second;
+		else if (op == 9)
+			std::cout << mp.try_emplace(k, i).second;
+		else if (op == 10)
+			std::cout << mp.insert_or_assign(k, i).second;
+		else if (op == 11)
+			std::cout << mp.erase(k);
+		else if (op == 12 && mp.find(k) != mp.end())
+			mp.erase(mp.find(k));
+		else if (op == 13)
+			mp.erase(mp.lower_bound(k), mp.upper_bound(k + 2));
+		else if (op == 14 && i % 5 == 0)
+			mp.insert(mp.end(), _pair<const int, int>(k, i));
+		else if (op == 15 && i % 7 == 0)
+			mp.swap(other);
+		std::cout << (i % 60 == 59 ? "\n" : " ");
+		if (i % 1000 == 999)
+		{
+			stats("map", mp);
+			stats("other", other);
+		}
+	}
+
+	M	copy(mp);
+
+	stats("copy", copy);
+	std::cout << at(copy, 0) << " " << at(copy, 1) << " " << at(copy, 0) << std::endl;
+	stats("copy", copy);
+	other = mp;
+	stats("assigned", other);
+	std::cout << at(other, 0) << " " << at(other, 0) << std::endl;
+	stats("assigned", other);
+	mp.clear();
+	stats("cleared", mp);
+	for (int k = 0; k < 8; ++k)
+		mp[k] = k;
+	for (int k = 0; k < 8; ++k)
+		std::cout << at(mp, k) << at(mp, k);
+	std::cout << std::endl;
+	stats("refilled", mp);
+}
+
+// The same key erased and inserted again: a lookup never returns the
+// freed node.
+template <typename M>
+void	reuse(void)
+{
+	M	mp;
+
+	for (int i = 0; i < 200; ++i)
+	{
+		mp[i % 3] = i;
+		std::cout << at(mp, i % 3) << ":" << at(mp, i % 3);
+		mp.erase(i % 3);
+		std::cout << ":" << at(mp, i % 3) << " ";
+	}
+	std::cout << std::endl;
+	stats("reuse", mp);
+}
+
+int		main(void)
+{
+	run<_hot_map<int, int, small_cache> >(45);
+	run<_hot_map<int, int, cache> >(46);
+	reuse<_hot_map<int, int, small_cache> >();
+	reuse<_hot_map<int, int, cache> >();
+	return (0);
+}
@@ -0,0 +1,134 @@
+#include "common.hpp"
+
+typedef _map<int, int>	map;
+typedef _set<int>		set;
+
+// From every position it of c: the reverse iterator built on it points at
+// the element before it, gives it back through base(), and steps both
+// ways, converted to const or not.
+template <typename C>
+void	positions(C &c)
+{
+	typedef typename C::iterator				it_type;
+	typedef typename C::reverse_iterator		rit_type;
+	typedef typename C::const_reverse_iterator	crit_type;
+	unsigned long	h = 0;
+	bool			ok = true;
+
+	for (it_type it = c.begin(); ; ++it)
+	{
+		rit_type	r(it);
+		crit_type	cr = r;
+
+		ok = ok && r.base() == it && cr.base() == it && cr == r && !(r != cr);
+		if (it != c.begin())
+		{
+			it_type	prev = it;
+
+			--prev;
+			ok = ok && &*r == &*prev && &*cr == &*prev && r.operator->() == prev.operator->();
+			h = h * 31 + key(*r);
+			rit_type	old = r++;
+			ok = ok && old.base() == it && r.base() == prev && --r == old;
+			ok = ok && r++ == old && r.base() == prev && --r == old;
+		}
+		else
+			ok = ok && r == c.rend() && cr == c.rend();
+		if (it == c.end())
+		{
+			ok = ok && r == c.rbegin();
+			break ;
+		}
+	}
+	std::cout << "size " << c.size() << ", positions " << ok << ", digest " << h << std::endl;
+}
+
+// Both ways over the whole container, and back from rend().
+template <typename C>
+void	walks(C const &c)
+{
+	std::cout << "reverse:";
+	for (typename C::const_reverse_iterator it = c.rbegin(); it != c.rend(); ++it)
+		std::cout << " " << key(*it);
+	std::cout << " | back:";
+	for (typename C::const_reverse_iterator it = c.rend(); it != c.rbegin(); )
+		std::cout << " " << key(*--it);
+	std::cout << std::endl;
+}
+
+int		main(void)
+{
+	map		mp;
+	set		st;
+
+	positions(mp);
+	walks(mp);
+	std::cout << "empty: " << (mp.rbegin() == mp.rend()) << (mp.rbegin().base() == mp.end())
+		<< (mp.rend().base() == mp.begin()) << std::endl;
+
+	// small shapes, the root being the first or last node among them
+	int		orders[][4] = { {1, 2, 3, 4}, {4, 3, 2, 1}, {2, 1, 3, 4}, {3, 4, 1, 2} };
+
+	for (int o = 0; o < 4; ++o)
+	{
+		map	small;
+
+		for (int i = 0; i < 4; ++i)
+		{
+			small[orders[o][i]] = i;
+			positions(small);
+			walks(small);
+		}
+	}
+
+	unsigned long	seed = 40;
+
+	for (int i = 0; i < 200; ++i)
+	{
+		const int	k = lcg(seed) % 1000;
+
+		mp[k] = i;
+		st.insert(k);
+	}
+	positions(mp);
+	positions(st);
+
+	// writes through a reverse iterator
+	int	n = 0;
+	for (map::reverse_iterator it = mp.rbegin(); it != mp.rend(); ++it)
+		it->second = n++;
+	std::cout << "first " << mp.begin()->first << "=" << mp.begin()->second
+		<< ", last " << mp.rbegin()->first << "=" << (*mp.rbegin()).second << std::endl;
+
+	// erasing while walking back: a reverse iterator on the erased
+	// element is rebuilt from what erase() leaves
+	for (map::reverse_iterator it = mp.rbegin(); it != mp.rend(); )
+	{
+		if (it->first % 3 == 0)
+		{
+			map::iterator	victim = it.base();
+
+			--victim;
+			++it;
+			mp.erase(victim);
+		}
+		else
+			++it;
+	}
+	for (set::reverse_iterator it = st.rbegin(); it != st.rend(); )
+	{
+		set::iterator	next = it.base();
+
+		if (*it % 2 == 0)
+		{
+			st.erase(*it);
+			it = set::reverse_iterator(next);
+		}
+		else
+			++it;
+	}
+	positions(mp);
+	positions(st);
+	walks(st);
+	return (0);
+}
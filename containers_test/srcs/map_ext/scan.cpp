@@ -0,0 +1,87 @@
+#include "common.hpp"
+#include <functional>
+
+typedef _map<int, std::string>						map;
+typedef _map<int, int, std::greater<int> >			rmap;
+typedef _set<int>									set;
+
+// Visits [lo, hi], stopping after limit values; prints what it saw.
+template <typename C>
+void	printRange(C const &c, int lo, int hi, size_t limit = 1000)
+{
+	std::vector<int>	seen;
+	bool				done = c.for_each_in_range(lo, hi, [&](typename C::value_type const &v) {
+		seen.push_back(key(v));
+		return seen.size() < limit;
+	});
+
+	std::cout << "[" << lo << ", " << hi << "] limit " << limit << ": " << done << ",";
+	for (size_t i = 0; i < seen.size(); ++i)
+		std::cout << " " << seen[i];
+	std::cout << std::endl;
+}
+
+template <typename C>
+void	ranges(C const &c)
+{
+	int	bounds[][2] = { {10, 40}, {40, 10}, {-50, 5}, {95, 500}, {500, 600}, {-9, -1},
+		{12, 12}, {13, 13}, {0, 99} };
+
+	for (size_t i = 0; i < sizeof(bounds) / sizeof(*bounds); ++i)
+	{
+		printRange(c, bounds[i][0], bounds[i][1]);
+		printRange(c, bounds[i][0], bounds[i][1], 3);
+	}
+}
+
+int		main(void)
+{
+	unsigned long	seed = 39;
+	map				mp;
+	set				st;
+
+	ranges(mp);
+	for (int i = 0; i < 60; ++i)
+	{
+		const int	k = lcg(seed) % 100;
+
+		mp.insert(_pair<const int, std::string>(k, std::string(1, 'a' + k % 26)));
+		st.insert(k);
+	}
+	ranges(mp);
+	ranges(st);
+
+	// the non-const scans hand out writable values
+	size_t	n = 0;
+	bool	done = mp.for_each([&n](map::value_type &v) { v.second += "!"; return ++n < 20; });
+
+	std::cout << "for_each: " << done << " " << n << std::endl;
+	done = mp.for_each_in_range(50, 80, [](map::value_type &v) { v.second = "?"; return true; });
+	std::cout << "for_each_in_range: " << done << std::endl;
+	map const	&cmp = mp;
+	cmp.for_each([](map::value_type const &v) { std::cout << v.first << v.second << " "; return true; });
+	std::cout << std::endl;
+	n = 0;
+	std::cout << "set for_each: " << st.for_each([&n](int v) { n += v; return true; }) << " " << n << std::endl;
+
+	// the range follows the comparator: lo comes first in its order
+	rmap	rmp;
+
+	for (int i = 0; i < 30; ++i)
+		rmp[i * 3] = i;
+	printRange(rmp, 40, 10);
+	printRange(rmp, 10, 40);
+	printRange(rmp, 100, 80, 2);
+
+	// ascending inserts: a path of 1500 nodes in a splay tree
+	map		deep;
+
+	for (int i = 0; i < 1500; ++i)
+		deep.insert(deep.end(), _pair<const int, std::string>(i, ""));
+	n = 0;
+	std::cout << "deep: " << deep.for_each([&n](map::value_type const &v) { n += v.first; return true; })
+		<< " " << n << std::endl;
+	printRange(deep, 1490, 2000);
+	printRange(deep, 700, 720, 5);
+	return (0);
+}
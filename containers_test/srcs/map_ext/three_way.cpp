@@ -0,0 +1,156 @@
+#include "common.hpp"
+#include <cctype>
+#include <cmath>
+#include <algorithm>
+
+// Case-insensitive order, with the compare() the tree looks for.
+struct	nocase
+{
+	int		compare(std::string const &a, std::string const &b) const
+	{
+		for (size_t i = 0; i < a.size() && i < b.size(); ++i)
+		{
+			const int	x = std::tolower(a[i]);
+			const int	y = std::tolower(b[i]);
+
+			if (x != y)
+				return (x < y ? -1 : 1);
+		}
+		return (a.size() < b.size() ? -1 : a.size() > b.size());
+	}
+
+	bool	operator()(std::string const &a, std::string const &b) const
+	{ return compare(a, b) < 0; }
+};
+
+typedef ft::counting_compare<nocase, std::string>	comp;
+typedef _map<std::string, int, comp>				map;
+typedef _set<std::string, comp>					set;
+
+std::string	word(unsigned long &seed)
+{
+	std::string	s;
+
+	for (int n = 3 + lcg(seed) % 4; n > 0; --n)
+		s += (lcg(seed) % 2 ? 'A' : 'a') + lcg(seed) % 6;
+	return (s);
+}
+
+std::string	key_str(std::string const &s) { return (s); }
+template <typename P>
+std::string	key_str(P const &p) { return (p.first); }
+
+template <typename It, typename End>
+std::string	at(It it, End end)
+{
+	return (it == end ? std::string("end") : key_str(*it));
+}
+
+// Every lookup answers as the less-than order does, keys equal but for
+// case included.
+template <typename C>
+void	lookups(C &c, std::vector<std::string> const &probes)
+{
+	for (size_t i = 0; i < probes.size(); ++i)
+	{
+		const std::string	&k = probes[i];
+
+		std::cout << k << ": " << at(c.find(k), c.end()) << " " << c.count(k)
+			<< " [" << at(c.lower_bound(k), c.end()) << ", " << at(c.upper_bound(k), c.end()) << ")";
+		std::cout << " [" << at(c.equal_range(k).first, c.end()) << ", " << at(c.equal_range(k).second, c.end()) << ")" << std::endl;
+	}
+}
+
+// Calls per operation stay near the height of the tree. find() is held
+// to one comparison a level, a less-than only tree needs one and a half on
+// average to stop on an equal key.
+template <typename C, typename Op>
+void	cost(char const *name, C &c, ft::compare_stats &stats, std::vector<std::string> const &keys, Op op, double a, double b)
+{
+	const double	bound = a * std::log(double(c.size())) / std::log(2.0) + b;
+
+	stats.calls = 0;
+	for (size_t i = 0; i < keys.size(); ++i)
+		op(c, keys[i]);
+	std::cout << name << ": " << (double(stats.calls) / keys.size() <= bound ? "within" : "over")
+		<< " " << a << " log2(n) + " << b << " per call" << std::endl;
+}
+
+template <typename C>
+void	find(C &c, std::string const &k) { c.find(k); }
+template <typename C>
+void	count(C &c, std::string const &k) { c.count(k); }
+template <typename C>
+void	lower_bound(C &c, std::string const &k) { c.lower_bound(k); }
+template <typename C>
+void	equal_range(C &c, std::string const &k) { c.equal_range(k); }
+
+int		main(void)
+{
+	unsigned long				seed = 42;
+	ft::compare_stats			stats;
+	map							mp((comp(&stats)));
+	set							st((comp(&stats)));
+	std::vector<std::string>	probes;
+
+	std::cout << "three-way: " << ft::has_three_way<comp, std::string>::value
+		<< " " << ft::has_three_way<nocase, std::string>::value
+		<< " " << ft::has_three_way<ft::counting_compare<ft::less<std::string>, std::string>, std::string>::value << std::endl;
+
+	for (int i = 0; i < 60; ++i)
+	{
+		const std::string	k = word(seed);
+		_pair<map::iterator, bool>		r = mp.insert(_pair<const std::string, int>(k, i));
+		_pair<set::iterator, bool>		s = st.insert(k);
+
+		std::cout << k << " -> " << r.first->first << " " << r.first->second << " " << r.second
+			<< " | " << *s.first << " " << s.second << std::endl;
+	}
+	for (int i = 0; i < 40; ++i)
+		probes.push_back(word(seed));
+	probes.push_back("");
+	for (map::iterator it = mp.begin(); it != mp.end(); ++it)
+		if (probes.size() < 55)
+		{
+			std::string	up(it->first);
+
+			for (size_t i = 0; i < up.size(); ++i)
+				up[i] = std::toupper(up[i]);
+			probes.push_back(up);
+		}
+	probes.push_back(mp.begin()->first);
+	probes.push_back((--mp.end())->first);
+	lookups(mp, probes);
+	lookups(st, probes);
+	for (size_t i = 0; i < probes.size(); i += 3)
+		std::cout << probes[i] << " erased " << mp.erase(probes[i]) << " " << st.erase(probes[i]) << std::endl;
+	for (map::iterator it = mp.begin(); it != mp.end(); ++it)
+		std::cout << it->first << "=" << it->second << " ";
+	std::cout << std::endl;
+	lookups(mp, probes);
+
+	map							big((comp(&stats)));
+	set							bst((comp(&stats)));
+	std::vector<std::string>	keys;
+
+	for (int i = 0; i < 4096; ++i)
+		keys.push_back(std::string(1, 'a' + i % 26) + std::string(1, 'a' + i / 26 % 26) + std::string(1, 'a' + i / 676));
+	for (size_t i = keys.size() - 1; i > 0; --i)
+		std::swap(keys[i], keys[lcg(seed) % (i + 1)]);
+	for (size_t i = 0; i < keys.size(); ++i)
+	{
+		big.insert(_pair<const std::string, int>(keys[i], int(i)));
+		bst.insert(keys[i]);
+	}
+	std::cout << "sizes " << big.size() << " " << bst.size() << std::endl;
+	std::reverse(keys.begin(), keys.end());
+	cost("map find", big, stats, keys, find<map>, 1, 4);
+	cost("map count", big, stats, keys, count<map>, 1.5, 3);
+	cost("map lower_bound", big, stats, keys, lower_bound<map>, 1.5, 3);
+	cost("map equal_range", big, stats, keys, equal_range<map>, 2, 3);
+	cost("set find", bst, stats, keys, find<set>, 1, 4);
+	cost("set count", bst, stats, keys, count<set>, 1.5, 3);
+	cost("set lower_bound", bst, stats, keys, lower_bound<set>, 1.5, 3);
+	cost("set equal_range", bst, stats, keys, equal_range<set>, 2, 3);
+	return (0);
+}
@@ -0,0 +1,67 @@
+#include "common.hpp"
+
+// Counts what is built, copied and destroyed, to see where the mapped
+// value is constructed.
+struct	counted
+{
+	static int	built, copied, assigned, destroyed;
+
+	counted(void) : a(0), b(0) { ++built; }
+	counted(int x) : a(x), b(0) { ++built; }
+	counted(int x, std::string const &y) : a(x), b(y.size()) { ++built; }
+	counted(counted const &x) : a(x.a), b(x.b) { ++copied; }
+	~counted(void) { ++destroyed; }
+	counted	&operator=(counted const &x) { a = x.a; b = x.b; ++assigned; return (*this); }
+
+	static void	reset(void) { built = copied = assigned = destroyed = 0; }
+
+	int		a;
+	size_t	b;
+};
+
+int	counted::built, counted::copied, counted::assigned, counted::destroyed;
+
+typedef _map<int, counted>	map;
+
+// The result, then what the call built: a mapped value is constructed
+// once in the node and only when the key is new.
+template <typename R>
+void	show(char const *name, int k, R const &r)
+{
+	std::cout << name << "(" << k << "): " << r.first->first << "=" << r.first->second.a << "/" << r.first->second.b
+		<< " " << r.second << " | built " << counted::built << " copied " << counted::copied
+		<< " assigned " << counted::assigned << " destroyed " << counted::destroyed << std::endl;
+	counted::reset();
+}
+
+int		main(void)
+{
+	unsigned long	seed = 43;
+	map				mp;
+	const counted	v(7);
+
+	counted::reset();
+	for (int i = 0; i < 12; ++i)
+	{
+		const int	k = lcg(seed) % 10;
+
+		show("find_or_insert", k, mp.find_or_insert(k));
+		show("try_emplace", k + 1, mp.try_emplace(k + 1));
+		show("try_emplace", k + 2, mp.try_emplace(k + 2, i));
+		show("try_emplace", k + 3, mp.try_emplace(k + 3, i, std::string(i, 'x')));
+		show("insert_or_assign", k + 4, mp.insert_or_assign(k + 4, v));
+		mp[k + 5].a += i;
+		std::cout << "[" << k + 5 << "] " << mp[k + 5].a << " | built " << counted::built << " copied " << counted::copied
+			<< " assigned " << counted::assigned << " destroyed " << counted::destroyed << std::endl;
+		counted::reset();
+		if (i % 3 == 0)
+			std::cout << "erased " << mp.erase(k) << std::endl;
+		counted::reset();
+	}
+	std::cout << "size " << mp.size() << std::endl;
+	for (map::iterator it = mp.begin(); it != mp.end(); ++it)
+		std::cout << it->first << "=" << it->second.a << "/" << it->second.b << " ";
+	std::cout << std::endl;
+	counted::reset();
+	return (0);
+}
@@ -0,0 +1,69 @@
+#include "../map_ext/common.hpp"
+#include <cstdlib>
+
+// Built with FT_RB_THREADED (see CFLAGS): the prev / next list through the
+// header must hold the nodes of the tree in order, which the std build
+// has nothing to compare with.
+template <typename Node>
+void	inorder(Node x, std::vector<Node> &out)
+{
+	while (x != 0)
+	{
+		inorder<Node>(x->left, out);
+		out.push_back(x);
+		x = x->right;
+	}
+}
+
+template <typename C>
+void	checkThreadsOf(C const &c)
+{
+	typedef typename C::const_iterator::Node_ptr	Node;
+	Node				hdr = c.end()._node;
+	std::vector<Node>	nodes;
+
+	inorder<Node>(hdr->parent, nodes);
+	Node	prev = hdr;
+	for (size_t i = 0; i < nodes.size(); ++i)
+	{
+		if (prev->next != nodes[i] || nodes[i]->prev != prev)
+		{
+			std::cerr << "thread broken at node " << i << std::endl;
+			std::abort();
+		}
+		prev = nodes[i];
+	}
+	if (prev->next != hdr || hdr->prev != prev)
+	{
+		std::cerr << "thread not closed through the header" << std::endl;
+		std::abort();
+	}
+}
+
+template <typename K, typename T, typename C, typename A, typename H, typename B>
+void	checkThreads(ft::map<K, T, C, A, H, B> const &c) { checkThreadsOf(c); }
+template <typename K, typename C, typename A, typename H, typename B>
+void	checkThreads(ft::set<K, C, A, H, B> const &c) { checkThreadsOf(c); }
+template <typename K, typename T, typename C, typename A>
+void	checkThreads(std::map<K, T, C, A> const &) { }
+template <typename K, typename C, typename A>
+void	checkThreads(std::set<K, C, A> const &) { }
+
+// Walks c both ways with ++ and --, and checks the links.
+template <typename C>
+void	printWalk(char const *name, C const &c)
+{
+	unsigned long	fwd = 0;
+	unsigned long	bwd = 0;
+	size_t			n = 0;
+
+	checkThreads(c);
+	for (typename C::const_iterator it = c.begin(); it != c.end(); ++it, ++n)
+		fwd = fwd * 31 + key(*it);
+	for (typename C::const_iterator it = c.end(); it != c.begin(); )
+		bwd = bwd * 31 + key(*--it);
+	std::cout << name << " size " << c.size() << ", walked " << n << ", fwd " << fwd << ", bwd " << bwd;
+	if (!c.empty())
+		std::cout << ", first " << key(*c.begin()) << ", last " << key(*c.rbegin());
+	std::cout << std::endl;
+}
@@ -0,0 +1,65 @@
+#include "common.hpp"
+
+typedef _map<int, int>	map;
+
+// Random inserts, hinted inserts and erases of all kinds keep the thread
+// in step with the tree; so do copies, assignment, swap and clear.
+int		main(void)
+{
+	unsigned long	seed = 38;
+	map				mp;
+	map				other;
+
+	for (int op = 0; op < 6000; ++op)
+	{
+		const int	k = lcg(seed) % 700;
+
+		switch (lcg(seed) % 8)
+		{
+			case 0:
+			case 1:
+				mp.insert(_pair<const int, int>(k, op));
+				break ;
+			case 2:
+				mp.insert(mp.lower_bound(k), _pair<const int, int>(k, op));
+				break ;
+			case 3:
+				mp.insert(lcg(seed) % 2 ? mp.begin() : mp.end(), _pair<const int, int>(k, op));
+				break ;
+			case 4:
+				mp[k] = op;
+				break ;
+			case 5:
+				mp.erase(k);
+				break ;
+			case 6:
+				if (mp.find(k) != mp.end())
+					mp.erase(mp.find(k));
+				break ;
+			case 7:
+				mp.erase(mp.lower_bound(k), mp.lower_bound(k + 5));
+				break ;
+		}
+		if (op % 500 == 0)
+		{
+			printWalk("mp", mp);
+			map	cpy(mp);
+
+			printWalk("cpy", cpy);
+			cpy.erase(cpy.begin(), cpy.lower_bound(350));
+			other = cpy;
+			printWalk("other", other);
+		}
+		if (op % 1500 == 0)
+		{
+			mp.swap(other);
+			printWalk("mp", mp);
+			printWalk("other", other);
+		}
+	}
+	mp.clear();
+	printWalk("mp", mp);
+	mp.insert(other.begin(), other.end());
+	printWalk("mp", mp);
+	return (0);
+}
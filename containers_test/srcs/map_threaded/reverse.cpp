@@ -0,0 +1 @@
+#include "../map_ext/reverse.cpp"
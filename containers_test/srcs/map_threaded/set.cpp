@@ -0,0 +1,52 @@
+#include "common.hpp"
+
+typedef _set<int>	set;
+
+// The same for set, whose erase(value) and range insert take their own
+// paths.
+int		main(void)
+{
+	unsigned long		seed = 83;
+	set					st;
+	std::vector<int>	batch;
+
+	for (int op = 0; op < 4000; ++op)
+	{
+		const int	k = lcg(seed) % 500;
+
+		switch (lcg(seed) % 5)
+		{
+			case 0:
+				st.insert(k);
+				break ;
+			case 1:
+				st.insert(st.upper_bound(k), k);
+				break ;
+			case 2:
+				batch.assign(1, k);
+				for (int i = 1; i < 8; ++i)
+					batch.push_back((k + i * 61) % 500);
+				st.insert(batch.begin(), batch.end());
+				break ;
+			case 3:
+				st.erase(k);
+				break ;
+			case 4:
+				st.erase(st.lower_bound(k), st.upper_bound(k + 3));
+				break ;
+		}
+		if (op % 400 == 0)
+		{
+			set	cpy(st);
+
+			printWalk("st", st);
+			printWalk("cpy", cpy);
+		}
+	}
+	set	empty;
+
+	st.swap(empty);
+	printWalk("st", st);
+	printWalk("empty", empty);
+	return (0);
+}
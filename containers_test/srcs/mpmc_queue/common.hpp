@@ -0,0 +1,89 @@
+#include "mpmc_queue.hpp"
+#include <deque>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <iostream>
+#include <string>
+
+#ifndef TESTED_NAMESPACE
+# define TESTED_NAMESPACE ft
+#endif
+
+// There is no std::mpmc_queue: the std build runs the tests on this model,
+// a std::deque behind a mutex, bounded by the capacity rounded up to a
+// power of two, two at least.
+namespace model {
+	template <typename T>
+	class mpmc_queue {
+		public:
+			typedef T		value_type;
+			typedef size_t	size_type;
+
+			explicit mpmc_queue(size_type capacity) : _cap(2) {
+				while (_cap < capacity)
+					_cap <<= 1;
+			};
+
+			size_type	capacity(void) const { return _cap; };
+			size_type	size_approx(void) const {
+				std::lock_guard<std::mutex>	lock(_m);
+				return _d.size();
+			};
+
+			bool	try_push(T const &val) {
+				std::lock_guard<std::mutex>	lock(_m);
+				if (_d.size() == _cap)
+					return false;
+				_d.push_back(val);
+				_cv.notify_all();
+				return true;
+			};
+			bool	try_pop(T &out) {
+				std::lock_guard<std::mutex>	lock(_m);
+				if (_d.empty())
+					return false;
+				out = _d.front();
+				_d.pop_front();
+				_cv.notify_all();
+				return true;
+			};
+			template <typename It>
+			size_type	try_pop_n(It out, size_type n) {
+				std::lock_guard<std::mutex>	lock(_m);
+				size_type					i = 0;
+				for (; i < n && !_d.empty(); ++i, ++out)
+				{
+					*out = _d.front();
+					_d.pop_front();
+				}
+				_cv.notify_all();
+				return i;
+			};
+			void	push(T const &val) {
+				std::unique_lock<std::mutex>	lock(_m);
+				_cv.wait(lock, [this]() { return _d.size() < _cap; });
+				_d.push_back(val);
+				_cv.notify_all();
+			};
+			void	pop(T &out) {
+				std::unique_lock<std::mutex>	lock(_m);
+				_cv.wait(lock, [this]() { return !_d.empty(); });
+				out = _d.front();
+				_d.pop_front();
+				_cv.notify_all();
+			};
+
+		private:
+			std::deque<T>			_d;
+			size_type				_cap;
+			mutable std::mutex		_m;
+			std::condition_variable	_cv;
+	};
+}
+
+#define _ns_ft ft
+#define _ns_std model
+#define _cat(a, b) a ## b
+#define _xcat(a, b) _cat(a, b)
+#define _mpmc _xcat(_ns_, TESTED_NAMESPACE)::mpmc_queue
@@ -0,0 +1,66 @@
+#include "common.hpp"
+#include <vector>
+#include <list>
+#include <iterator>
+
+#define TESTED_TYPE std::string
+
+typedef _mpmc<TESTED_TYPE>	queue;
+
+void	fill(queue &q, int n)
+{
+	for (int i = 0; i < n; ++i)
+		q.try_push(std::to_string(i));
+}
+
+int		main(void)
+{
+	size_t	caps[] = { 0, 1, 2, 3, 8, 100 };
+
+	for (size_t c = 0; c < 6; ++c)
+	{
+		queue	q(caps[c]);
+		size_t	pushed = 0;
+
+		while (q.try_push(std::string(pushed % 3 + 1, 'a' + pushed % 26)))
+			++pushed;
+		std::cout << "capacity " << caps[c] << " -> " << q.capacity() << ", pushed " << pushed
+			<< ", size " << q.size_approx() << std::endl;
+		TESTED_TYPE	s;
+		std::cout << "try_pop:";
+		while (q.try_pop(s))
+			std::cout << " " << s;
+		std::cout << " | size " << q.size_approx() << std::endl;
+	}
+
+	// try_pop_n through any output iterator, insert iterators included
+	queue						q(16);
+	std::vector<TESTED_TYPE>	vec(4);
+	std::list<TESTED_TYPE>		lst(1, "end");
+
+	fill(q, 12);
+	std::cout << "try_pop_n(0): " << q.try_pop_n(vec.begin(), 0) << std::endl;
+	std::cout << "into vector: " << q.try_pop_n(vec.begin(), 4) << std::endl;
+	std::cout << "back_inserter: " << q.try_pop_n(std::back_inserter(vec), 3) << std::endl;
+	std::cout << "inserter: " << q.try_pop_n(std::inserter(lst, lst.begin()), 2) << std::endl;
+	std::cout << "front_inserter: " << q.try_pop_n(std::front_inserter(lst), 100) << std::endl;
+	std::cout << "on empty: " << q.try_pop_n(std::back_inserter(vec), 5) << std::endl;
+	for (size_t i = 0; i < vec.size(); ++i)
+		std::cout << vec[i] << " ";
+	std::cout << "| ";
+	for (std::list<TESTED_TYPE>::iterator it = lst.begin(); it != lst.end(); ++it)
+		std::cout << *it << " ";
+	std::cout << std::endl;
+
+	// laps around the ring
+	for (int lap = 0; lap < 50; ++lap)
+	{
+		std::vector<TESTED_TYPE>	out;
+
+		fill(q, lap % 17);
+		q.try_pop_n(std::back_inserter(out), lap % 11);
+		if (lap % 10 == 0)
+			std::cout << "lap " << lap << ": popped " << out.size() << ", size " << q.size_approx() << std::endl;
+	}
+	return (0);
+}
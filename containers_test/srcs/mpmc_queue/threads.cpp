@@ -0,0 +1,98 @@
+#include "common.hpp"
+#include <vector>
+
+#define TESTED_TYPE unsigned long
+
+typedef _mpmc<TESTED_TYPE>	queue;
+
+const int			producers = 3;
+const int			consumers = 3;
+const TESTED_TYPE	per_producer = 20000;
+
+// Values are producer * per_producer + i. Each consumer checks that the
+// values of one producer reach it in increasing order, and the totals show
+// that every value was popped once. mode 0 uses the try_ calls, yielding
+// when they fail, mode 1 the blocking ones.
+void	run(size_t capacity, int mode)
+{
+	queue						q(capacity);
+	std::vector<std::thread>	threads;
+	TESTED_TYPE					sums[consumers] = {};
+	TESTED_TYPE					counts[consumers] = {};
+	bool						ordered[consumers];
+	TESTED_TYPE					quota = producers * per_producer / consumers;
+
+	for (int p = 0; p < producers; ++p)
+		threads.push_back(std::thread([&q, p, mode]() {
+			for (TESTED_TYPE i = 0; i < per_producer; ++i)
+			{
+				TESTED_TYPE	v = p * per_producer + i;
+
+				if (mode == 1)
+					q.push(v);
+				else
+					while (!q.try_push(v))
+						std::this_thread::yield();
+			}
+		}));
+	for (int c = 0; c < consumers; ++c)
+	{
+		ordered[c] = true;
+		threads.push_back(std::thread([&, c]() {
+			TESTED_TYPE	last[producers];
+			TESTED_TYPE	out[4];
+
+			for (int p = 0; p < producers; ++p)
+				last[p] = 0;
+			while (counts[c] < quota)
+			{
+				size_t	got = 0;
+
+				if (mode == 1)
+				{
+					q.pop(out[0]);
+					got = 1;
+				}
+				else if (counts[c] % 2 == 0)
+					got = q.try_pop(out[0]) ? 1 : 0;
+				else
+					got = q.try_pop_n(out, quota - counts[c] < 4 ? quota - counts[c] : 4);
+				if (got == 0)
+					std::this_thread::yield();
+				for (size_t k = 0; k < got; ++k)
+				{
+					const int	p = out[k] / per_producer;
+
+					ordered[c] = ordered[c] && out[k] + 1 > last[p];
+					last[p] = out[k] + 1;
+					sums[c] += out[k];
+					++counts[c];
+				}
+			}
+		}));
+	}
+	for (size_t i = 0; i < threads.size(); ++i)
+		threads[i].join();
+
+	TESTED_TYPE	sum = 0;
+	TESTED_TYPE	count = 0;
+	bool		in_order = true;
+
+	for (int c = 0; c < consumers; ++c)
+	{
+		sum += sums[c];
+		count += counts[c];
+		in_order = in_order && ordered[c];
+	}
+	std::cout << "capacity " << q.capacity() << ", mode " << mode << ": popped " << count
+		<< ", sum " << sum << ", in order " << in_order << ", left " << q.size_approx() << std::endl;
+}
+
+int		main(void)
+{
+	run(2, 0);
+	run(64, 0);
+	run(2, 1);
+	run(64, 1);
+	return (0);
+}
@@ -0,0 +1,104 @@
+#include "persistent_map.hpp"
+#include <map>
+#include <iostream>
+#include <string>
+
+#ifndef TESTED_NAMESPACE
+# define TESTED_NAMESPACE ft
+#endif
+
+#define _pair TESTED_NAMESPACE::pair
+
+// There is no std::persistent_map: the std build runs the tests on this
+// model, which copies a whole std::map for every version.
+namespace model {
+	template <typename Key, typename T>
+	class persistent_map {
+		public:
+			typedef std::map<Key, T>						map_type;
+			typedef typename map_type::value_type			value_type;
+			typedef typename map_type::size_type			size_type;
+			typedef typename map_type::const_iterator		const_iterator;
+			typedef const_iterator							iterator;
+
+			persistent_map(void) { };
+			template <typename It>
+			persistent_map(It first, It last) : _m(first, last) { };
+
+			persistent_map	insert(value_type const &val) const {
+				persistent_map	tmp(*this);
+				tmp._m.insert(val);
+				return tmp;
+			};
+			persistent_map	assign(Key const &k, T const &obj) const {
+				persistent_map	tmp(*this);
+				tmp._m[k] = obj;
+				return tmp;
+			};
+			persistent_map	erase(Key const &k) const {
+				persistent_map	tmp(*this);
+				tmp._m.erase(k);
+				return tmp;
+			};
+
+			const_iterator	begin(void) const { return _m.begin(); };
+			const_iterator	end(void) const { return _m.end(); };
+			size_type		size(void) const { return _m.size(); };
+			bool			empty(void) const { return _m.empty(); };
+			T const			&at(Key const &k) const { return _m.at(k); };
+			const_iterator	find(Key const &k) const { return _m.find(k); };
+			size_type		count(Key const &k) const { return _m.count(k); };
+			const_iterator	lower_bound(Key const &k) const { return _m.lower_bound(k); };
+			const_iterator	upper_bound(Key const &k) const { return _m.upper_bound(k); };
+
+		private:
+			map_type	_m;
+	};
+}
+
+#define _ns_ft ft
+#define _ns_std model
+#define _cat(a, b) a ## b
+#define _xcat(a, b) _cat(a, b)
+#define _pmap _xcat(_ns_, TESTED_NAMESPACE)::persistent_map
+
+template <typename T>
+std::string	printPair(const T &iterator, bool nl = true, std::ostream &o = std::cout)
+{
+	o << "key: " << iterator->first << " | value: " << iterator->second;
+	if (nl)
+		o << std::endl;
+	return ("");
+}
+
+template <typename T_MAP>
+void	printSize(T_MAP const &mp, bool print_content = 1)
+{
+	std::cout << "size: " << mp.size() << std::endl;
+	if (print_content)
+	{
+		typename T_MAP::const_iterator it = mp.begin(), ite = mp.end();
+		std::cout << std::endl << "Content is:" << std::endl;
+		for (; it != ite; ++it)
+			std::cout << "- " << printPair(it, false) << std::endl;
+	}
+	std::cout << "###############################################" << std::endl;
+}
+
+// Order-sensitive digest of a whole version.
+template <typename T_MAP>
+unsigned long	digest(T_MAP const &mp)
+{
+	unsigned long	h = mp.size();
+
+	for (typename T_MAP::const_iterator it = mp.begin(); it != mp.end(); ++it)
+		h = h * 1000003 + (unsigned long)it->first * 31 + (unsigned long)it->second;
+	return (h);
+}
+
+// Deterministic in both builds.
+inline unsigned long	lcg(unsigned long &seed)
+{
+	seed = seed * 6364136223846793005UL + 1442695040888963407UL;
+	return (seed >> 33);
+}
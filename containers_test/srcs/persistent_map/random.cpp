@@ -0,0 +1,46 @@
+#include "common.hpp"
+
+#define T1 int
+#define T2 int
+
+typedef _pmap<T1, T2>	pmap;
+
+// Random inserts, assigns and erases over a small key range. Every 97th
+// version is kept with the digest it had when taken, and all of them are
+// checked again at the end: updates must never show through a snapshot.
+int		main(void)
+{
+	unsigned long	seed = 42;
+	pmap			cur;
+	pmap			snaps[64];
+	unsigned long	taken[64];
+	int				n = 0;
+
+	for (int i = 0; i < 6000; ++i)
+	{
+		T1		k = lcg(seed) % 300;
+		T2		v = lcg(seed) % 1000;
+
+		switch (lcg(seed) % 3)
+		{
+			case 0: cur = cur.insert(_pair<const T1, T2>(k, v)); break;
+			case 1: cur = cur.assign(k, v); break;
+			default: cur = cur.erase(k); break;
+		}
+		if (i % 97 == 0 && n < 64)
+		{
+			snaps[n] = cur;
+			taken[n] = digest(cur);
+			std::cout << "snapshot " << n << ": size " << cur.size() << " digest " << taken[n] << std::endl;
+			++n;
+		}
+		if (i % 500 == 0)
+			std::cout << "op " << i << ": size " << cur.size() << " digest " << digest(cur) << std::endl;
+	}
+	for (int i = 0; i < n; ++i)
+		if (digest(snaps[i]) != taken[i])
+			std::cout << "snapshot " << i << " changed" << std::endl;
+	std::cout << "checked " << n << " snapshots" << std::endl;
+	printSize(cur);
+	return (0);
+}
@@ -0,0 +1,75 @@
+#include "common.hpp"
+
+#define T1 int
+#define T2 std::string
+
+typedef _pmap<T1, T2>	pmap;
+
+void	ft_find(pmap const &mp, T1 const &k)
+{
+	pmap::const_iterator	ret = mp.find(k);
+
+	if (ret != mp.end())
+		printPair(ret);
+	else
+		std::cout << "persistent_map::find(" << k << ") returned end()" << std::endl;
+}
+
+void	ft_bound(pmap const &mp, T1 const &k)
+{
+	pmap::const_iterator	lo = mp.lower_bound(k), hi = mp.upper_bound(k);
+
+	std::cout << "bounds(" << k << "): ";
+	std::cout << (lo == mp.end() ? std::string("end") : lo->second) << " ";
+	std::cout << (hi == mp.end() ? std::string("end") : hi->second) << std::endl;
+}
+
+int		main(void)
+{
+	pmap	v0;
+	pmap	v1 = v0.insert(_pair<const T1, T2>(42, "fgzgxfn"));
+	pmap	v2 = v1.insert(_pair<const T1, T2>(25, "funny")).insert(_pair<const T1, T2>(80, "hey"));
+	pmap	v3 = v2.assign(25, "no longer funny").assign(12, "no");
+	pmap	v4 = v3.erase(42).erase(1000);
+	pmap	v5 = v4.insert(_pair<const T1, T2>(12, "ignored, 12 is there"));
+	pmap	copy(v3);
+
+	printSize(v0);
+	printSize(v1);
+	printSize(v2);
+	printSize(v3);
+	printSize(v4);
+	printSize(v5);
+	printSize(copy);
+
+	std::cout << "\t-- FIND --" << std::endl;
+	ft_find(v3, 12);
+	ft_find(v3, 42);
+	ft_find(v4, 42);
+	ft_find(v0, 42);
+
+	std::cout << "\t-- COUNT --" << std::endl;
+	std::cout << v2.count(25) << v2.count(12) << v3.count(12) << v4.count(42) << std::endl;
+
+	std::cout << "\t-- BOUNDS --" << std::endl;
+	ft_bound(v3, 0);
+	ft_bound(v3, 12);
+	ft_bound(v3, 30);
+	ft_bound(v3, 80);
+	ft_bound(v3, 81);
+
+	std::cout << "\t-- AT --" << std::endl;
+	std::cout << v3.at(25) << std::endl;
+	try {
+		v4.at(42);
+	}
+	catch (std::out_of_range &e) {
+		std::cout << "out_of_range" << std::endl;
+	}
+
+	pmap	range(v3.begin(), v3.end());
+
+	printSize(range);
+	std::cout << "empty: " << v0.empty() << range.empty() << std::endl;
+	return (0);
+}
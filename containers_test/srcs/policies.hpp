@@ -0,0 +1,154 @@
+#ifndef POLICIES_HPP
+# define POLICIES_HPP
+
+#include "map.hpp"
+#include "set.hpp"
+#include "Splay_algo.hpp"
+#include "Avl_algo.hpp"
+#include <cstdlib>
+#include <iostream>
+
+// ft::map and ft::set on the other balancing policies, for fct.sh to run
+// the map and set tests with -DTESTED_NAMESPACE=ft_splay or ft_avl. Every
+// modifier and the destructor walk the whole tree and abort on a broken
+// invariant: parent links, header min/max, node count, key order, and
+// the balance of the policy.
+
+// A splay tree has no balance to keep.
+template <typename Node>
+void	checkBalance(Node, int, int, ft::Splay_balance)
+{
+}
+
+// Subtree heights differ by one at most, and the balance factor kept in
+// color matches them.
+template <typename Node>
+void	checkBalance(Node x, int l, int r, ft::Avl_balance)
+{
+	ft::Color	expected = l == r ? ft::_black : l < r ? ft::_right_high : ft::_left_high;
+
+	if (l - r > 1 || r - l > 1 || x->color != expected)
+	{
+		std::cerr << "AVL heights " << l << " and " << r << " under a node balanced " << x->color << std::endl;
+		std::abort();
+	}
+}
+
+template <typename Node, typename Parent, typename Balance>
+int		checkNode(Node x, Parent parent, size_t &count, Balance policy)
+{
+	if (x == 0)
+		return (0);
+	if (x->parent != parent)
+	{
+		std::cerr << "broken parent link" << std::endl;
+		std::abort();
+	}
+	++count;
+	int	l = checkNode(x->left, x, count, policy);
+	int	r = checkNode(x->right, x, count, policy);
+
+	checkBalance(x, l, r, policy);
+	return (1 + (l > r ? l : r));
+}
+
+template <typename Balance, typename Tree>
+void	checkTree(Tree const &t)
+{
+	typedef typename Tree::const_iterator	it_type;
+	it_type	ite = t.end();
+	it_type	it = t.begin();
+	size_t	count = 0;
+
+	checkNode(ite._node->parent, ite._node, count, Balance());
+	if (count != t.size())
+	{
+		std::cerr << "node count " << count << " != size " << t.size() << std::endl;
+		std::abort();
+	}
+	typename it_type::Node_ptr	min = ite._node->parent, max = ite._node->parent;
+
+	while (min != 0 && min->left != 0)
+		min = min->left;
+	while (max != 0 && max->right != 0)
+		max = max->right;
+	if (count == 0 ? ite._node->left != ite._node || ite._node->right != ite._node
+		: ite._node->left != min || ite._node->right != max)
+	{
+		std::cerr << "header does not hold min and max" << std::endl;
+		std::abort();
+	}
+	for (it_type prev = it; it != ite; prev = it)
+		if (++it != ite && !t.value_comp()(*prev, *it))
+		{
+			std::cerr << "keys out of order" << std::endl;
+			std::abort();
+		}
+}
+
+#define _POLICY_MAP(Balance) \
+	template <class Key, class T, class Compare = ft::less<Key>, class Alloc = std::allocator<ft::pair<const Key, T> > > \
+	class map : public ft::map<Key, T, Compare, Alloc, ft::Rb_no_cache, Balance> { \
+		typedef ft::map<Key, T, Compare, Alloc, ft::Rb_no_cache, Balance>	base; \
+		public: \
+			typedef typename base::key_type		key_type; \
+			typedef typename base::mapped_type	mapped_type; \
+			typedef typename base::value_type	value_type; \
+			typedef typename base::iterator		iterator; \
+			typedef typename base::size_type	size_type; \
+			explicit map(const Compare &comp = Compare(), const Alloc &alloc = Alloc()) : base(comp, alloc) { }; \
+			template <class It> \
+			map(It first, It last, const Compare &comp = Compare(), const Alloc &alloc = Alloc()) : base(first, last, comp, alloc) { checkTree<Balance>(*this); }; \
+			map(map const &x) : base(x) { checkTree<Balance>(*this); }; \
+			~map(void) { checkTree<Balance>(*this); }; \
+			map	&operator=(map const &x) { base::operator=(x); checkTree<Balance>(*this); return *this; }; \
+			mapped_type	&operator[](key_type const &k) { mapped_type &v = base::operator[](k); checkTree<Balance>(*this); return v; }; \
+			ft::pair<iterator, bool>	insert(value_type const &val) { ft::pair<iterator, bool> r = base::insert(val); checkTree<Balance>(*this); return r; }; \
+			iterator	insert(iterator pos, value_type const &val) { iterator r = base::insert(pos, val); checkTree<Balance>(*this); return r; }; \
+			template <class It> \
+			void		insert(It first, It last) { base::insert(first, last); checkTree<Balance>(*this); }; \
+			void		erase(iterator pos) { base::erase(pos); checkTree<Balance>(*this); }; \
+			size_type	erase(key_type const &k) { size_type n = base::erase(k); checkTree<Balance>(*this); return n; }; \
+			void		erase(iterator first, iterator last) { base::erase(first, last); checkTree<Balance>(*this); }; \
+			void		swap(map &x) { base::swap(x); checkTree<Balance>(*this); checkTree<Balance>(x); }; \
+			void		clear(void) { base::clear(); checkTree<Balance>(*this); }; \
+	};
+
+#define _POLICY_SET(Balance) \
+	template <class Key, class Compare = ft::less<Key>, class Alloc = std::allocator<Key> > \
+	class set : public ft::set<Key, Compare, Alloc, ft::Rb_no_cache, Balance> { \
+		typedef ft::set<Key, Compare, Alloc, ft::Rb_no_cache, Balance>	base; \
+		public: \
+			typedef typename base::value_type	value_type; \
+			typedef typename base::iterator		iterator; \
+			typedef typename base::size_type	size_type; \
+			explicit set(const Compare &comp = Compare(), const Alloc &alloc = Alloc()) : base(comp, alloc) { }; \
+			template <class It> \
+			set(It first, It last, const Compare &comp = Compare(), const Alloc &alloc = Alloc()) : base(first, last, comp, alloc) { checkTree<Balance>(*this); }; \
+			set(set const &x) : base(x) { checkTree<Balance>(*this); }; \
+			~set(void) { checkTree<Balance>(*this); }; \
+			set	&operator=(set const &x) { base::operator=(x); checkTree<Balance>(*this); return *this; }; \
+			ft::pair<iterator, bool>	insert(value_type const &val) { ft::pair<iterator, bool> r = base::insert(val); checkTree<Balance>(*this); return r; }; \
+			iterator	insert(iterator pos, value_type const &val) { iterator r = base::insert(pos, val); checkTree<Balance>(*this); return r; }; \
+			template <class It> \
+			void		insert(It first, It last) { base::insert(first, last); checkTree<Balance>(*this); }; \
+			void		erase(iterator pos) { base::erase(pos); checkTree<Balance>(*this); }; \
+			size_type	erase(value_type const &k) { size_type n = base::erase(k); checkTree<Balance>(*this); return n; }; \
+			void		erase(iterator first, iterator last) { base::erase(first, last); checkTree<Balance>(*this); }; \
+			void		swap(set &x) { base::swap(x); checkTree<Balance>(*this); checkTree<Balance>(x); }; \
+			void		clear(void) { base::clear(); checkTree<Balance>(*this); }; \
+	};
+
+namespace ft_splay {
+	using namespace ft;
+	_POLICY_MAP(ft::Splay_balance)
+	_POLICY_SET(ft::Splay_balance)
+}
+
+namespace ft_avl {
+	using namespace ft;
+	_POLICY_MAP(ft::Avl_balance)
+	_POLICY_SET(ft::Avl_balance)
+}
+
+#endif
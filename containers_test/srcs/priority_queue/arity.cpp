@@ -0,0 +1,39 @@
+#include "common.hpp"
+
+#define TESTED_TYPE int
+
+typedef TESTED_NAMESPACE::vector<TESTED_TYPE>	vec;
+
+// The same random pushes and pops on heaps of every fan-out; the top must
+// not depend on it.
+template <typename T_PQ>
+void	run(const char *name)
+{
+	unsigned long	seed = 7;
+	T_PQ			pq;
+	unsigned long	tops = 0;
+
+	for (int i = 0; i < 20000; ++i)
+	{
+		if (lcg(seed) % 3 != 0 || pq.empty())
+			pq.push(lcg(seed) % 5000);
+		else
+		{
+			tops = tops * 31 + pq.top();
+			pq.pop();
+		}
+	}
+	std::cout << name << ": tops " << tops << std::endl;
+	printDrain(pq);
+}
+
+int		main(void)
+{
+	run<_pq<TESTED_TYPE, vec, std::less<TESTED_TYPE>, 2> >("binary");
+	run<_pq<TESTED_TYPE, vec, std::less<TESTED_TYPE>, 3> >("ternary");
+	run<_pq<TESTED_TYPE, vec, std::less<TESTED_TYPE>, 4> >("4-ary");
+	run<_pq<TESTED_TYPE, vec, std::less<TESTED_TYPE>, 8> >("8-ary");
+	run<_pq<TESTED_TYPE, vec, greater<TESTED_TYPE>, 5> >("5-ary min");
+	run<_pq<TESTED_TYPE, vec, std::less<TESTED_TYPE>, 1> >("unary");
+	return (0);
+}
@@ -0,0 +1,71 @@
+#include "queue.hpp"
+#include "vector.hpp"
+#include <queue>
+#include <vector>
+#include <iostream>
+#include <string>
+
+#ifndef TESTED_NAMESPACE
+# define TESTED_NAMESPACE ft
+#endif
+
+// std::priority_queue has no Arity, push_range nor pop_push: the std build
+// runs the tests on this model, which ignores the arity and pushes and pops
+// one element at a time.
+namespace model {
+	template <typename T, typename Container = std::vector<T>, typename Compare = std::less<T>, size_t Arity = 4>
+	class priority_queue : public std::priority_queue<T, Container, Compare> {
+		typedef std::priority_queue<T, Container, Compare>	base;
+		public:
+			explicit priority_queue(const Compare &comp = Compare(), const Container &c = Container()) : base(comp, c) { };
+			template <typename It>
+			priority_queue(It first, It last, const Compare &comp = Compare()) : base(first, last, comp) { };
+
+			template <typename It>
+			void	push_range(It first, It last) {
+				for (; first != last; ++first)
+					this->push(*first);
+			};
+			void	pop_push(T const &val) {
+				if (!this->empty())
+					this->pop();
+				this->push(val);
+			};
+	};
+}
+
+#define _ns_ft ft
+#define _ns_std model
+#define _cat(a, b) a ## b
+#define _xcat(a, b) _cat(a, b)
+#define _pq _xcat(_ns_, TESTED_NAMESPACE)::priority_queue
+
+// Min-heap order, the same type in both builds.
+template <typename T>
+struct greater {
+	bool	operator()(T const &x, T const &y) const { return y < x; };
+};
+
+// Pops everything, printing a digest and the first few values.
+template <typename T_PQ>
+void	printDrain(T_PQ &pq, int shown = 8)
+{
+	unsigned long	h = pq.size();
+	int				i = 0;
+
+	std::cout << "size: " << pq.size() << " |";
+	for (; !pq.empty(); pq.pop(), ++i)
+	{
+		if (i < shown)
+			std::cout << " " << pq.top();
+		h = h * 1000003 + (unsigned long)pq.top();
+	}
+	std::cout << " | digest " << h << std::endl;
+}
+
+// Deterministic in both builds.
+inline unsigned long	lcg(unsigned long &seed)
+{
+	seed = seed * 6364136223846793005UL + 1442695040888963407UL;
+	return (seed >> 33);
+}
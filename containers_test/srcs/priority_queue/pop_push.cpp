@@ -0,0 +1,36 @@
+#include "common.hpp"
+
+#define TESTED_TYPE int
+
+typedef TESTED_NAMESPACE::vector<TESTED_TYPE>	vec;
+
+template <typename T_PQ>
+void	run(const char *name)
+{
+	unsigned long	seed = 11;
+	T_PQ			pq;
+
+	// on an empty queue it is a push
+	pq.pop_push(42);
+	std::cout << name << ": top " << pq.top() << " size " << pq.size() << std::endl;
+	for (int i = 0; i < 64; ++i)
+		pq.push(lcg(seed) % 1000);
+	for (int i = 0; i < 5000; ++i)
+	{
+		pq.pop_push(lcg(seed) % 1000);
+		if (i % 1000 == 0)
+			std::cout << "top " << pq.top() << " size " << pq.size() << std::endl;
+	}
+	// values smaller and larger than everything
+	pq.pop_push(-1);
+	pq.pop_push(5000);
+	printDrain(pq);
+}
+
+int		main(void)
+{
+	run<_pq<TESTED_TYPE, vec, std::less<TESTED_TYPE>, 2> >("binary");
+	run<_pq<TESTED_TYPE, vec, std::less<TESTED_TYPE>, 4> >("4-ary");
+	run<_pq<TESTED_TYPE, vec, greater<TESTED_TYPE>, 6> >("6-ary min");
+	return (0);
+}
@@ -0,0 +1,50 @@
+#include "common.hpp"
+
+#define TESTED_TYPE int
+
+typedef TESTED_NAMESPACE::vector<TESTED_TYPE>	vec;
+typedef _pq<TESTED_TYPE, vec, std::less<TESTED_TYPE>, 4>	pqueue;
+
+int		main(void)
+{
+	unsigned long	seed = 3;
+	vec				batch;
+
+	for (int i = 0; i < 1000; ++i)
+		batch.push_back(lcg(seed) % 777);
+
+	// a batch bigger than the heap rebuilds it, a smaller one is sifted in
+	for (size_t heap = 0; heap <= 600; heap += 150)
+	{
+		for (size_t n = 0; n <= 400; n += 100)
+		{
+			pqueue	pq(batch.begin(), batch.begin() + heap);
+
+			pq.push_range(batch.begin() + heap, batch.begin() + heap + n);
+			std::cout << heap << " + " << n << ": ";
+			printDrain(pq, 4);
+		}
+	}
+
+	// ascending batches: each new element is the largest so far
+	for (size_t n = 1; n <= 4; ++n)
+	{
+		pqueue	pq(batch.begin(), batch.begin() + 10);
+		vec		up;
+
+		for (size_t i = 1; i <= n; ++i)
+			up.push_back(1000 + i);
+		pq.push_range(up.begin(), up.end());
+		std::cout << "top after " << n << " ascending: " << pq.top() << std::endl;
+		printDrain(pq, 4);
+	}
+
+	// any input iterator
+	pqueue	pq;
+	int		arr[] = { 5, 1, 9, 9, 0, 3 };
+
+	pq.push_range(arr, arr + 6);
+	pq.push_range(arr, arr);
+	printDrain(pq);
+	return (0);
+}
@@ -0,0 +1,50 @@
+#include "common.hpp"
+
+// live counts the values alive in every version.
+struct counted {
+	static std::atomic<int>	live;
+
+	counted(int v = 0) : value(v) { ++live; };
+	counted(counted const &src) : value(src.value) { ++live; };
+	~counted(void) { --live; };
+	counted &operator=(counted const &src) { value = src.value; return *this; };
+
+	int	value;
+};
+
+std::atomic<int>	counted::live(0);
+
+typedef _rmap<int, counted>	map;
+
+// A reader stays inside read() while the main thread empties the map, so
+// the version it holds is retired, not freed. Once the reader is gone,
+// collect() frees it with no further write.
+int		main(void)
+{
+	map					m;
+	std::atomic<int>	stage(0);
+
+	for (int i = 0; i < 100; ++i)
+		m.insert_or_assign(i, counted(i));
+	std::cout << "live " << counted::live << std::endl;
+
+	std::thread	reader([&]() {
+		m.read([&](map::map_type const &v) {
+			stage = 1;
+			while (stage != 2)
+				std::this_thread::yield();
+			std::cout << "reader still sees " << v.size() << std::endl;
+		});
+	});
+	while (stage != 1)
+		std::this_thread::yield();
+	for (int i = 0; i < 100; i += 2)
+		m.erase(i);
+	m.insert_or_assign(1000, counted(1000));
+	stage = 2;
+	reader.join();
+
+	std::cout << "collect " << m.collect() << ", live " << counted::live
+		<< ", size " << m.size() << std::endl;
+	return (0);
+}
@@ -0,0 +1,130 @@
+#include "read_mostly_map.hpp"
+#include <map>
+#include <mutex>
+#include <thread>
+#include <atomic>
+#include <iostream>
+#include <string>
+
+#ifndef TESTED_NAMESPACE
+# define TESTED_NAMESPACE ft
+#endif
+
+// There is no std::read_mostly_map: the std build runs the tests on this
+// model, a persistent_map model copying a whole std::map for every
+// version, swapped behind a mutex. Readers work on a copy, so a writer
+// never waits for them.
+namespace model {
+	template <typename Key, typename T>
+	class persistent_map {
+		public:
+			typedef std::map<Key, T>					map_type;
+			typedef typename map_type::value_type		value_type;
+			typedef typename map_type::size_type		size_type;
+			typedef typename map_type::const_iterator	const_iterator;
+
+			persistent_map	assign(Key const &k, T const &obj) const {
+				persistent_map	tmp(*this);
+				tmp._m[k] = obj;
+				return tmp;
+			};
+			persistent_map	erase(Key const &k) const {
+				persistent_map	tmp(*this);
+				tmp._m.erase(k);
+				return tmp;
+			};
+
+			const_iterator	begin(void) const { return _m.begin(); };
+			const_iterator	end(void) const { return _m.end(); };
+			size_type		size(void) const { return _m.size(); };
+			bool			empty(void) const { return _m.empty(); };
+			const_iterator	find(Key const &k) const { return _m.find(k); };
+
+		private:
+			map_type	_m;
+	};
+
+	template <typename Key, typename T>
+	class read_mostly_map {
+		public:
+			typedef Key						key_type;
+			typedef T						mapped_type;
+			typedef size_t					size_type;
+			typedef persistent_map<Key, T>	map_type;
+
+			template <typename Fn>
+			void	read(Fn fn) const { fn(snapshot()); };
+			bool	find(key_type const &k, mapped_type &out) const {
+				map_type	m = snapshot();
+				typename map_type::const_iterator	it = m.find(k);
+
+				if (it == m.end())
+					return false;
+				out = it->second;
+				return true;
+			};
+			bool		contains(key_type const &k) const {
+				map_type	m = snapshot();
+				return m.find(k) != m.end();
+			};
+			size_type	size(void) const { return snapshot().size(); };
+			bool		empty(void) const { return size() == 0; };
+			map_type	snapshot(void) const {
+				std::lock_guard<std::mutex>	lock(_m);
+				return _current;
+			};
+
+			template <typename Fn>
+			void	update(Fn fn) {
+				std::lock_guard<std::mutex>	writer(_writer);
+				map_type					next = snapshot();
+
+				fn(next);
+				std::lock_guard<std::mutex>	lock(_m);
+				_current = next;
+			};
+			bool	insert_or_assign(key_type const &k, mapped_type const &val) {
+				bool	inserted = false;
+
+				update([&](map_type &m) {
+					const size_type	n = m.size();
+
+					m = m.assign(k, val);
+					inserted = m.size() != n;
+				});
+				return inserted;
+			};
+			size_type	erase(key_type const &k) {
+				size_type	n = 0;
+
+				update([&](map_type &m) {
+					n = m.size();
+					m = m.erase(k);
+					n -= m.size();
+				});
+				return n;
+			};
+			void	clear(void) { update([](map_type &m) { m = map_type(); }); };
+			size_type	collect(void) { return 0; };
+
+		private:
+			map_type			_current;
+			mutable std::mutex	_m;
+			std::mutex			_writer;
+	};
+}
+
+#define _ns_ft ft
+#define _ns_std model
+#define _cat(a, b) a ## b
+#define _xcat(a, b) _cat(a, b)
+#define _rmap _xcat(_ns_, TESTED_NAMESPACE)::read_mostly_map
+
+template <typename T_MAP>
+void	printMap(T_MAP const &mp)
+{
+	std::cout << "size " << mp.size() << ":";
+	for (typename T_MAP::const_iterator it = mp.begin(); it != mp.end(); ++it)
+		std::cout << " " << it->first << "=" << it->second;
+	std::cout << std::endl;
+}
@@ -0,0 +1,48 @@
+#include "common.hpp"
+#include <stdexcept>
+
+typedef _rmap<int, std::string>	map;
+
+int		main(void)
+{
+	map			m;
+	std::string	s;
+
+	std::cout << "empty " << m.empty() << ", size " << m.size() << std::endl;
+	for (int i = 0; i < 20; ++i)
+		std::cout << m.insert_or_assign((i * 7) % 13, std::to_string(i));
+	std::cout << std::endl;
+	m.read([](map::map_type const &v) { printMap(v); });
+
+	// a snapshot keeps its version through later writes
+	map::map_type	before = m.snapshot();
+
+	std::cout << "erase: " << m.erase(3) << m.erase(3) << m.erase(100) << std::endl;
+	std::cout << "find 4: " << m.find(4, s) << " " << s << ", find 3: " << m.find(3, s) << std::endl;
+	std::cout << "contains 5: " << m.contains(5) << ", contains 3: " << m.contains(3) << std::endl;
+
+	// update publishes a batch at once
+	m.update([](map::map_type &v) {
+		for (int i = 0; i < 30; i += 3)
+			v = v.assign(i, "batch");
+		v = v.erase(1);
+	});
+	m.read([](map::map_type const &v) { printMap(v); });
+
+	// an update that throws publishes nothing
+	try {
+		m.update([](map::map_type &v) {
+			v = v.erase(0);
+			throw std::runtime_error("update");
+		});
+	}
+	catch (std::runtime_error &e) {
+		std::cout << e.what() << ": contains 0: " << m.contains(0) << std::endl;
+	}
+
+	m.clear();
+	std::cout << "cleared: empty " << m.empty() << ", collect " << m.collect() << std::endl;
+	printMap(before);
+	printMap(m.snapshot());
+	return (0);
+}
@@ -0,0 +1,70 @@
+#include "common.hpp"
+#include <vector>
+
+typedef _rmap<int, long>	map;
+
+const int	keys = 32;
+const long	total = 1000 * keys;
+
+// Writers move amounts between keys in one update, readers check that
+// every version they see holds the same total.
+int		main(void)
+{
+	map							m;
+	std::vector<std::thread>	threads;
+	std::atomic<bool>			done(false);
+	std::atomic<long>			bad(0);
+
+	m.update([](map::map_type &v) {
+		for (int k = 0; k < keys; ++k)
+			v = v.assign(k, total / keys);
+	});
+	for (int w = 0; w < 2; ++w)
+		threads.push_back(std::thread([&m, w]() {
+			for (int i = 0; i < 3000; ++i)
+			{
+				const int	from = (i * 5 + w) % keys;
+				const int	to = (i * 11 + 3 * w + 1) % keys;
+
+				if (from == to)
+					continue ;
+				m.update([from, to](map::map_type &v) {
+					const long	a = v.find(from)->second;
+					const long	b = v.find(to)->second;
+
+					v = v.assign(from, a - 7).assign(to, b + 7);
+				});
+				if (i % 50 == 0)
+					std::this_thread::yield();
+			}
+		}));
+	for (int r = 0; r < 3; ++r)
+		threads.push_back(std::thread([&]() {
+			while (!done)
+			{
+				m.read([&](map::map_type const &v) {
+					long	sum = 0;
+
+					for (map::map_type::const_iterator it = v.begin(); it != v.end(); ++it)
+						sum += it->second;
+					if (sum != total || v.size() != (size_t)keys)
+						++bad;
+				});
+				std::this_thread::yield();
+			}
+		}));
+	threads[0].join();
+	threads[1].join();
+	done = true;
+	for (size_t i = 2; i < threads.size(); ++i)
+		threads[i].join();
+
+	long	sum = 0;
+	m.read([&](map::map_type const &v) {
+		for (map::map_type::const_iterator it = v.begin(); it != v.end(); ++it)
+			sum += it->second;
+	});
+	std::cout << "inconsistent reads " << bad << ", total " << sum << ", size " << m.size()
+		<< ", collect " << m.collect() << std::endl;
+	return (0);
+}
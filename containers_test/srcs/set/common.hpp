@@ -2,6 +2,7 @@
 #include <set>
 #include <iostream>
 #include <string>
+#include "../policies.hpp"
 
 #ifndef TESTED_NAMESPACE
 # define TESTED_NAMESPACE ft
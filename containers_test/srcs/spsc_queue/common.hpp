@@ -0,0 +1,88 @@
+#include "spsc_queue.hpp"
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <stdexcept>
+#include <iostream>
+#include <string>
+
+#ifndef TESTED_NAMESPACE
+# define TESTED_NAMESPACE ft
+#endif
+
+// There is no std::spsc_queue: the std build runs the tests on this model,
+// a std::deque behind a mutex, bounded by the capacity rounded up to a
+// power of two.
+namespace model {
+	template <typename T>
+	class spsc_queue {
+		public:
+			typedef T		value_type;
+			typedef size_t	size_type;
+
+			explicit spsc_queue(size_type capacity) : _cap(1) {
+				while (_cap < capacity)
+					_cap <<= 1;
+			};
+
+			size_type	capacity(void) const { return _cap; };
+			size_type	size_approx(void) const {
+				std::lock_guard<std::mutex>	lock(_m);
+				return _d.size();
+			};
+			bool		empty(void) const { return size_approx() == 0; };
+
+			bool	try_push(T const &val) {
+				std::lock_guard<std::mutex>	lock(_m);
+				if (_d.size() == _cap)
+					return false;
+				_d.push_back(val);
+				return true;
+			};
+			template <typename It>
+			size_type	push_n(It first, size_type n) {
+				std::lock_guard<std::mutex>	lock(_m);
+				size_type					i = 0;
+				for (; i < n && _d.size() < _cap; ++i, ++first)
+					_d.push_back(*first);
+				return i;
+			};
+			bool	try_pop(T &out) {
+				std::lock_guard<std::mutex>	lock(_m);
+				if (_d.empty())
+					return false;
+				out = std::move(_d.front());
+				_d.pop_front();
+				return true;
+			};
+			template <typename It>
+			size_type	pop_n(It out, size_type n) {
+				std::lock_guard<std::mutex>	lock(_m);
+				size_type					i = 0;
+				for (; i < n && !_d.empty(); ++i, ++out)
+				{
+					*out = std::move(_d.front());
+					_d.pop_front();
+				}
+				return i;
+			};
+
+		private:
+			std::deque<T>		_d;
+			size_type			_cap;
+			mutable std::mutex	_m;
+	};
+}
+
+#define _ns_ft ft
+#define _ns_std model
+#define _cat(a, b) a ## b
+#define _xcat(a, b) _cat(a, b)
+#define _spsc _xcat(_ns_, TESTED_NAMESPACE)::spsc_queue
+
+// Deterministic in both builds.
+inline unsigned long	lcg(unsigned long &seed)
+{
+	seed = seed * 6364136223846793005UL + 1442695040888963407UL;
+	return (seed >> 33);
+}
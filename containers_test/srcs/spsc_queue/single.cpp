@@ -0,0 +1,74 @@
+#include "common.hpp"
+#include <vector>
+#include <iterator>
+
+#define TESTED_TYPE std::string
+
+typedef _spsc<TESTED_TYPE>	queue;
+
+void	printPop(queue &q, size_t n)
+{
+	std::vector<TESTED_TYPE>	out;
+	size_t						got = q.pop_n(std::back_inserter(out), n);
+
+	std::cout << "pop_n(" << n << "): " << got << " |";
+	for (size_t i = 0; i < out.size(); ++i)
+		std::cout << " " << out[i];
+	std::cout << " | left " << q.size_approx() << std::endl;
+}
+
+int		main(void)
+{
+	size_t	caps[] = { 0, 1, 3, 4, 5, 100 };
+
+	for (size_t c = 0; c < 6; ++c)
+	{
+		queue	q(caps[c]);
+		size_t	pushed = 0;
+
+		while (q.try_push(std::string(pushed % 4 + 1, 'a' + pushed % 26)))
+			++pushed;
+		std::cout << "capacity " << caps[c] << " -> " << q.capacity() << ", pushed " << pushed
+			<< ", size " << q.size_approx() << ", empty " << q.empty() << std::endl;
+		printPop(q, 2);
+		printPop(q, 0);
+		printPop(q, 1000);
+		TESTED_TYPE	s;
+		std::cout << "try_pop on empty: " << q.try_pop(s) << std::endl;
+	}
+
+	// batches wrapping around the ring many times
+	unsigned long				seed = 9;
+	queue						q(8);
+	std::vector<TESTED_TYPE>	src;
+	unsigned long				next = 0;
+
+	for (int i = 0; i < 40; ++i)
+		src.push_back(std::to_string(i));
+	for (int round = 0; round < 300; ++round)
+	{
+		size_t	n = lcg(seed) % 12;
+		size_t	in = q.push_n(src.begin() + next % 20, n);
+
+		next += in;
+		if (round % 3 == 0)
+		{
+			TESTED_TYPE	s;
+			if (q.try_pop(s))
+				std::cout << s << ";";
+		}
+		else
+		{
+			std::vector<TESTED_TYPE>	out;
+			q.pop_n(std::back_inserter(out), lcg(seed) % 6);
+			for (size_t i = 0; i < out.size(); ++i)
+				std::cout << out[i] << ";";
+		}
+		if (round % 50 == 0)
+			std::cout << std::endl << "round " << round << ": pushed " << in << " of " << n
+				<< ", size " << q.size_approx() << std::endl;
+	}
+	std::cout << std::endl;
+	printPop(q, 100);
+	return (0);
+}
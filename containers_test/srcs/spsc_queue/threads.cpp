@@ -0,0 +1,68 @@
+#include "common.hpp"
+#include <vector>
+
+#define TESTED_TYPE unsigned long
+
+typedef _spsc<TESTED_TYPE>	queue;
+
+// One producer pushes 0..N-1, alone or in batches, one consumer pops them
+// the same ways: it must see every value once, in order. Both sides yield
+// when they make no progress, so that one core is enough.
+int		main(void)
+{
+	const TESTED_TYPE	n = 50000;
+	size_t				caps[] = { 1, 2, 16, 1024 };
+
+	for (size_t c = 0; c < 4; ++c)
+	{
+		queue			q(caps[c]);
+		TESTED_TYPE		sum = 0;
+		TESTED_TYPE		expected = 0;
+		bool			ordered = true;
+
+		std::thread	producer([&q, n]() {
+			TESTED_TYPE	batch[7];
+			TESTED_TYPE	i = 0;
+
+			while (i < n)
+			{
+				if (i % 3 == 0)
+				{
+					if (q.try_push(i))
+						++i;
+					else
+						std::this_thread::yield();
+					continue ;
+				}
+				size_t	k = 0;
+				for (; k < 7 && i + k < n; ++k)
+					batch[k] = i + k;
+				k = q.push_n(batch, k);
+				if (k == 0)
+					std::this_thread::yield();
+				i += k;
+			}
+		});
+		while (expected < n)
+		{
+			TESTED_TYPE	out[5];
+			size_t		got = 0;
+
+			if (expected % 2 == 0)
+				got = q.try_pop(out[0]) ? 1 : 0;
+			else
+				got = q.pop_n(out, 5);
+			if (got == 0)
+				std::this_thread::yield();
+			for (size_t k = 0; k < got; ++k, ++expected)
+			{
+				ordered = ordered && out[k] == expected;
+				sum += out[k];
+			}
+		}
+		producer.join();
+		std::cout << "capacity " << q.capacity() << ": popped " << expected << ", sum " << sum
+			<< ", in order " << ordered << ", left " << q.size_approx() << std::endl;
+	}
+	return (0);
+}
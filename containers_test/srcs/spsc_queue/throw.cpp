@@ -0,0 +1,81 @@
+#include "common.hpp"
+#include <vector>
+
+// Copies and moves throw once the fuse runs out; live counts the values
+// alive, and each value is checked when popped.
+class bomb {
+	public:
+		static int	live;
+		static int	fuse;
+
+		bomb(int v = 0) : value(v) { ++live; };
+		bomb(bomb const &src) : value(src.value) { _light(); ++live; };
+		bomb(bomb &&src) : value(src.value) { _light(); ++live; };
+		~bomb(void) { --live; };
+		bomb &operator=(bomb const &src) { _light(); value = src.value; return *this; };
+		bomb &operator=(bomb &&src) { _light(); value = src.value; return *this; };
+
+		int	value;
+
+	private:
+		static void	_light(void) {
+			if (fuse >= 0 && fuse-- == 0)
+				throw std::runtime_error("bomb");
+		};
+};
+
+int	bomb::live = 0;
+int	bomb::fuse = -1;
+
+typedef _spsc<bomb>	queue;
+
+int		main(void)
+{
+	std::vector<bomb>	src;
+
+	for (int i = 0; i < 12; ++i)
+		src.push_back(bomb(i));
+	std::cout << "live: " << bomb::live << std::endl;
+	{
+		queue	q(16);
+
+		// a throwing copy publishes the elements before it
+		bomb::fuse = 5;
+		try {
+			q.push_n(src.begin(), 12);
+		}
+		catch (std::runtime_error &e) {
+			std::cout << "push_n: " << e.what() << ", size " << q.size_approx() << std::endl;
+		}
+		bomb::fuse = -1;
+		std::cout << "push_n: " << q.push_n(src.begin() + 5, 7) << ", size " << q.size_approx() << std::endl;
+
+		// a throwing move frees the slots before it, the one that threw
+		// stays at the head
+		for (int fuse = 0; fuse < 4; ++fuse)
+		{
+			std::vector<bomb>	out(8);
+
+			bomb::fuse = fuse;
+			try {
+				q.pop_n(out.begin(), 3);
+				std::cout << "pop_n: popped" << std::endl;
+			}
+			catch (std::runtime_error &e) {
+				std::cout << "pop_n: " << e.what() << ", size " << q.size_approx() << std::endl;
+			}
+			bomb::fuse = -1;
+			std::cout << "popped:";
+			for (int i = 0; i < fuse && i < 3; ++i)
+				std::cout << " " << out[i].value;
+			std::cout << std::endl << "live: " << bomb::live << std::endl;
+		}
+		bomb	b;
+		std::cout << "rest:";
+		while (q.try_pop(b))
+			std::cout << " " << b.value;
+		std::cout << std::endl;
+	}
+	std::cout << "live: " << bomb::live << std::endl;
+	return (0);
+}
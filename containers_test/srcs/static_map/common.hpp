@@ -0,0 +1,89 @@
+#include "static_map.hpp"
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#ifndef TESTED_NAMESPACE
+# define TESTED_NAMESPACE ft
+#endif
+
+#define _pair TESTED_NAMESPACE::pair
+
+// There is no std::static_map: the std build runs the tests on this
+// model, a constexpr array searched front to back. It rejects duplicate
+// keys the same way, by failing the constant evaluation.
+namespace model {
+	template <typename Key>
+	constexpr bool	equal(Key const &x, Key const &y) { return x == y; }
+
+	constexpr bool	equal(const char *x, const char *y) {
+		while (*x && *x == *y) {
+			++x;
+			++y;
+		}
+		return *x == *y;
+	}
+
+	template <typename Key, typename T, size_t N>
+	class static_map {
+		public:
+			typedef std::pair<Key, T>	value_type;
+			typedef const value_type	*const_iterator;
+			typedef size_t				size_type;
+
+			constexpr explicit static_map(const value_type (&items)[N])
+			: static_map(items, std::make_index_sequence<N>()) { };
+
+			constexpr const_iterator	begin(void) const { return _items; };
+			constexpr const_iterator	end(void) const { return _items + N; };
+			constexpr size_type			size(void) const { return N; };
+			constexpr const_iterator	find(Key const &k) const {
+				for (size_type i = 0; i < N; ++i)
+					if (equal(_items[i].first, k))
+						return _items + i;
+				return end();
+			};
+			constexpr size_type	count(Key const &k) const { return find(k) != end(); };
+			constexpr bool		contains(Key const &k) const { return find(k) != end(); };
+			constexpr T const	&at(Key const &k) const {
+				if (find(k) == end())
+					throw std::out_of_range("static_map::at");
+				return find(k)->second;
+			};
+
+		private:
+			template <size_t... I>
+			constexpr static_map(const value_type (&items)[N], std::index_sequence<I...>)
+			: _items{items[I]...} {
+				for (size_type i = 0; i < N; ++i)
+					for (size_type j = 0; j < i; ++j)
+						if (equal(items[i].first, items[j].first))
+							throw std::logic_error("static_map: duplicate key");
+			};
+
+			value_type	_items[N];
+	};
+
+	template <typename Key, typename T, size_t N>
+	constexpr static_map<Key, T, N>	make_static_map(const std::pair<Key, T> (&items)[N])
+	{ return static_map<Key, T, N>(items); }
+}
+
+#define _ns_ft ft
+#define _ns_std model
+#define _cat(a, b) a ## b
+#define _xcat(a, b) _cat(a, b)
+#define _smap _xcat(_ns_, TESTED_NAMESPACE)::static_map
+#define _make_smap _xcat(_ns_, TESTED_NAMESPACE)::make_static_map
+
+// Whether a static_map of the N entries of Items::items is a constant
+// expression: a non-constant template argument is a substitution failure.
+template <int>
+struct	Constant { };
+
+template <typename Key, typename T, size_t N, typename Items>
+constexpr bool	builds(Constant<(_smap<Key, T, N>(Items::items), 0)> *) { return true; }
+
+template <typename Key, typename T, size_t N, typename Items>
+constexpr bool	builds(...) { return false; }
@@ -0,0 +1,24 @@
+#include "common.hpp"
+
+// Duplicate keys cannot build a static_map in a constant expression.
+struct	DupInts { static constexpr _pair<int, int>	items[3] = { { 1, 1 }, { 2, 2 }, { 1, 3 } }; };
+constexpr _pair<int, int>	DupInts::items[3];
+
+struct	UniqueInts { static constexpr _pair<int, int>	items[3] = { { 1, 1 }, { 2, 2 }, { 3, 3 } }; };
+constexpr _pair<int, int>	UniqueInts::items[3];
+
+// Equal content at different addresses is still a duplicate.
+struct	DupStrings { static constexpr _pair<const char *, int>	items[2] = { { "GET", 1 }, { "GET\0x", 2 } }; };
+constexpr _pair<const char *, int>	DupStrings::items[2];
+
+static_assert(!builds<int, int, 3, DupInts>(0), "duplicate ints");
+static_assert(builds<int, int, 3, UniqueInts>(0), "unique ints");
+static_assert(!builds<const char *, int, 2, DupStrings>(0), "duplicate strings");
+
+int		main(void)
+{
+	std::cout << "duplicate ints build: " << builds<int, int, 3, DupInts>(0) << std::endl;
+	std::cout << "unique ints build: " << builds<int, int, 3, UniqueInts>(0) << std::endl;
+	std::cout << "duplicate strings build: " << builds<const char *, int, 2, DupStrings>(0) << std::endl;
+	return (0);
+}
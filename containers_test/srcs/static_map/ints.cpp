@@ -0,0 +1,67 @@
+#include "common.hpp"
+
+#define T1 int
+#define T2 int
+
+// 64 keys over 64 buckets: some buckets hold several keys and get a seed,
+// the others store their slot.
+template <typename>
+struct	Squares;
+
+template <size_t... I>
+struct	Squares<std::index_sequence<I...> > {
+	static constexpr _pair<T1, T2>	items[] = { _pair<T1, T2>(T1(I * I) - 1000, T2(I))... };
+};
+
+template <size_t... I>
+constexpr _pair<T1, T2>	Squares<std::index_sequence<I...> >::items[];
+
+typedef Squares<std::make_index_sequence<64> >	squares;
+
+constexpr _smap<T1, T2, 64>	sq(squares::items);
+
+static_assert(sq.size() == 64, "size");
+static_assert(sq.at(-1000) == 0 && sq.at(-999) == 1 && sq.at(3969 - 1000) == 63, "at");
+static_assert(sq.find(1521 - 1000)->second == 39, "find");
+static_assert(sq.find(1521 - 1000)->first == 521, "find key");
+static_assert(sq.count(-1000) == 1 && sq.count(-998) == 0 && sq.count(4000) == 0, "count");
+static_assert(sq.contains(24 * 24 - 1000) && !sq.contains(24 * 24 - 999), "contains");
+static_assert(sq.find(2) == sq.end(), "absent");
+
+constexpr bool	all_found(void)
+{
+	for (int i = 0; i < 64; ++i)
+		if (sq.at(i * i - 1000) != i || sq.count(i * i - 999 + (i == 0)) != 0)
+			return false;
+	return true;
+}
+
+static_assert(all_found(), "every key");
+
+// One entry, and keys at the ends of the range.
+constexpr _pair<long, char>	ends[] = { _pair<long, char>(-9223372036854775807L - 1, 'a'),
+	_pair<long, char>(9223372036854775807L, 'z'), _pair<long, char>(0, 'm') };
+constexpr _smap<long, char, 3>	lm(ends);
+constexpr _pair<T1, T2>	one[] = { _pair<T1, T2>(42, 24) };
+constexpr _smap<T1, T2, 1>	om(one);
+
+static_assert(lm.at(-9223372036854775807L - 1) == 'a' && lm.at(9223372036854775807L) == 'z' && lm.at(0) == 'm', "ends");
+static_assert(om.at(42) == 24 && !om.contains(41), "one");
+
+int		main(void)
+{
+	int		sum = 0;
+
+	for (_smap<T1, T2, 64>::const_iterator it = sq.begin(); it != sq.end(); ++it)
+		sum += it->second;
+	std::cout << "size: " << sq.size() << " | sum of values: " << sum << std::endl;
+	for (int k = -1000; k < -900; k += 7)
+		std::cout << k << ": count " << sq.count(k) << std::endl;
+	try {
+		sq.at(7);
+	}
+	catch (std::out_of_range &e) {
+		std::cout << "at(7): out_of_range" << std::endl;
+	}
+	return (0);
+}
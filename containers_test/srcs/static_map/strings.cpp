@@ -0,0 +1,36 @@
+#include "common.hpp"
+
+#define T1 const char *
+#define T2 int
+
+constexpr auto	methods = _make_smap<T1, T2>({ { "GET", 1 }, { "PUT", 2 }, { "POST", 3 }, { "HEAD", 4 },
+	{ "DELETE", 5 }, { "PATCH", 6 }, { "OPTIONS", 7 }, { "TRACE", 8 }, { "CONNECT", 9 },
+	{ "PROPFIND", 10 }, { "MKCOL", 11 }, { "", 12 } });
+
+static_assert(methods.size() == 12, "size");
+static_assert(methods.at("GET") == 1 && methods.at("CONNECT") == 9 && methods.at("") == 12, "at");
+static_assert(methods.find("PATCH")->second == 6, "find");
+static_assert(methods.count("POST") == 1 && methods.count("POS") == 0 && methods.count("POSTS") == 0, "count");
+static_assert(!methods.contains("get") && !methods.contains(" GET"), "contains");
+static_assert(methods.find("LOCK") == methods.end(), "absent");
+
+enum	color { red, green, blue = 40 };
+
+constexpr auto	colors = _make_smap<color, T1>({ { blue, "blue" }, { red, "red" }, { green, "green" } });
+
+static_assert(model::equal(colors.at(blue), "blue") && model::equal(colors.at(red), "red"), "enum keys");
+
+int		main(void)
+{
+	const char	*words[] = { "GET", "get", "DELETE", "", "MKCOL", "MKCOLS", "TRACE" };
+
+	for (size_t i = 0; i < sizeof(words) / sizeof(*words); ++i)
+	{
+		std::cout << "\"" << words[i] << "\": count " << methods.count(words[i]);
+		if (methods.contains(words[i]))
+			std::cout << " | at " << methods.at(words[i]);
+		std::cout << std::endl;
+	}
+	std::cout << "green: " << colors.at(green) << std::endl;
+	return (0);
+}
@@ -0,0 +1,122 @@
+#pragma once
+# ifndef COW_BASE_HPP
+# define COW_BASE_HPP
+
+# include <algorithm>
+# include <memory>
+# include <new>
+# include "refcount.hpp"
+
+namespace ft {
+
+	// Reference-counted handle on a Container shared by copies until one
+	// of them writes. A handle that gave out mutable iterators or
+	// references is unshareable: copies made from it take their own deep
+	// copy, since the escaped references could still write through it.
+	template <typename Container, typename Alloc>
+	class	Cow_ptr {
+
+		private:
+			struct	Rep {
+				explicit Rep(const Container& c) : refs(1), shareable(true), value(c) {}
+
+				refcount_type	refs;
+				bool			shareable;
+				Container		value;
+			};
+
+			typedef typename Alloc::template rebind<Rep>::other	Rep_allocator;
+
+			// The Rep comes from the allocator of the container it holds.
+			static Rep*	_create_rep(const Container& c) {
+				Rep_allocator	alloc(c.get_allocator());
+				Rep*			rep = alloc.allocate(1);
+
+				try {
+					::new(static_cast<void*>(rep)) Rep(c);
+				}
+				catch (...) {
+					alloc.deallocate(rep, 1);
+					throw ;
+				}
+				return rep;
+			}
+
+			static void	_release(Rep* rep) {
+				if (refcount_release(rep->refs)) {
+					Rep_allocator	alloc(rep->value.get_allocator());
+
+					rep->~Rep();
+					alloc.deallocate(rep, 1);
+				}
+			}
+
+			static Rep*	_copy_rep(Rep* rep) {
+				if (!rep->shareable)
+					return _create_rep(rep->value);
+				refcount_acquire(rep->refs);
+				return rep;
+			}
+
+			// Takes a private copy if another handle shares the container.
+			void	_detach() {
+				if (!refcount_unique(_rep->refs)) {
+					Rep*	rep = _create_rep(_rep->value);
+					_release(_rep);
+					_rep = rep;
+				}
+			}
+
+		public:
+			explicit Cow_ptr(const Container& c) : _rep(_create_rep(c)) {}
+			Cow_ptr(const Cow_ptr& x) : _rep(_copy_rep(x._rep)) {}
+			~Cow_ptr() { _release(_rep); }
+
+			Cow_ptr&	operator=(const Cow_ptr& x) {
+				Rep*	rep = _copy_rep(x._rep);
+
+				_release(_rep);
+				_rep = rep;
+				return *this;
+			}
+
+			void	swap(Cow_ptr& x) { std::swap(_rep, x._rep); }
+
+			bool	unique() const { return refcount_unique(_rep->refs); }
+
+			const Container&	get() const { return _rep->value; }
+
+			// For a write that keeps no iterator nor reference.
+			Container&	write() {
+				_detach();
+				return _rep->value;
+			}
+
+			// For a write whose iterators or references outlive the call.
+			Container&	leak() {
+				_detach();
+				_rep->shareable = false;
+				return _rep->value;
+			}
+
+			// Empties the container without copying a shared one. No
+			// reference survives, so the handle becomes shareable again.
+			void	reset(const Container& empty) {
+				if (refcount_unique(_rep->refs)) {
+					_rep->value.clear();
+					_rep->shareable = true;
+				}
+				else {
+					Rep*	rep = _create_rep(empty);
+					_release(_rep);
+					_rep = rep;
+				}
+			}
+
+		private:
+			Rep*	_rep;
+	};
+
+}//namespace
+
+#endif
@@ -0,0 +1,140 @@
+#pragma once
+# ifndef COW_MAP_HPP
+# define COW_MAP_HPP
+
+# include "cow_base.hpp"
+# include "map.hpp"
+
+namespace ft {
+
+# define _HEADER_COW_MAP \
+		template <typename Key, typename T, typename Compare, typename Alloc>
+
+	// ft::map whose copies are O(1) and share the tree until one of them
+	// is modified. Every non-const member, begin(), find() and operator[]
+	// included, first takes a private copy if the tree is shared: look up
+	// through a const reference to keep sharing.
+	template <class Key, class T, class Compare = ft::less<Key>, class Alloc = std::allocator<pair<const Key, T> > >
+	class	cow_map {
+
+		public:
+			typedef ft::map<Key, T, Compare, Alloc>				map_type;
+			typedef typename map_type::key_type					key_type;
+			typedef typename map_type::mapped_type				mapped_type;
+			typedef typename map_type::value_type				value_type;
+			typedef typename map_type::key_compare				key_compare;
+			typedef typename map_type::value_compare			value_compare;
+			typedef typename map_type::allocator_type			allocator_type;
+			typedef typename map_type::reference				reference;
+			typedef typename map_type::const_reference			const_reference;
+			typedef typename map_type::pointer					pointer;
+			typedef typename map_type::const_pointer			const_pointer;
+			typedef typename map_type::iterator					iterator;
+			typedef typename map_type::const_iterator			const_iterator;
+			typedef typename map_type::reverse_iterator			reverse_iterator;
+			typedef typename map_type::const_reverse_iterator	const_reverse_iterator;
+			typedef typename map_type::difference_type			difference_type;
+			typedef typename map_type::size_type				size_type;
+
+		private:
+			Cow_ptr<map_type, Alloc>	_p;
+
+		public:
+			explicit cow_map(const Compare& comp = key_compare(), const allocator_type& alloc = allocator_type())
+			: _p(map_type(comp, alloc)) {}
+			template <class InputIterator>
+			cow_map(InputIterator first, InputIterator last, const Compare& comp = key_compare(), const allocator_type& alloc = allocator_type())
+			: _p(map_type(first, last, comp, alloc)) {}
+			explicit cow_map(const map_type& x) : _p(x) {}
+			cow_map(const cow_map& x) : _p(x._p) {}
+			~cow_map() {}
+
+			cow_map&	operator=(const cow_map& x) {
+				_p = x._p;
+				return *this;
+			}
+
+			// The shared tree, no copy is taken.
+			const map_type&	base() const { return _p.get(); }
+			bool			unique() const { return _p.unique(); }
+
+			allocator_type	get_allocator() const { return _p.get().get_allocator(); }
+
+			//iterators
+			iterator				begin() { return _p.leak().begin(); }
+			const_iterator			begin() const { return _p.get().begin(); }
+			iterator				end() { return _p.leak().end(); }
+			const_iterator			end() const { return _p.get().end(); }
+			reverse_iterator		rbegin() { return _p.leak().rbegin(); }
+			const_reverse_iterator	rbegin() const { return _p.get().rbegin(); }
+			reverse_iterator		rend() { return _p.leak().rend(); }
+			const_reverse_iterator	rend() const { return _p.get().rend(); }
+
+			//capacity
+			bool		empty() const { return _p.get().empty(); }
+			size_type	size() const { return _p.get().size(); }
+			size_type	max_size() const { return _p.get().max_size(); }
+
+			//element access
+			mapped_type&	operator[](const key_type& k) { return _p.leak()[k]; }
+
+			//modifiers
+			pair<iterator, bool>	insert(const value_type& val) { return _p.leak().insert(val); }
+			iterator				insert(iterator position, const value_type& val) { return _p.leak().insert(position, val); }
+			template <class InputIterator>
+			void					insert(InputIterator first, InputIterator last) { _p.write().insert(first, last); }
+
+			void		erase(iterator position) { _p.write().erase(position); }
+			size_type	erase(const key_type& k) { return _p.write().erase(k); }
+			void		erase(iterator first, iterator last) { _p.write().erase(first, last); }
+			void		swap(cow_map& x) { _p.swap(x._p); }
+			void		clear() { _p.reset(map_type(key_comp(), get_allocator())); }
+
+			//observers
+			key_compare		key_comp() const { return _p.get().key_comp(); }
+			value_compare	value_comp() const { return _p.get().value_comp(); }
+
+			//operations
+			iterator		find(const key_type& k) { return _p.leak().find(k); }
+			const_iterator	find(const key_type& k) const { return _p.get().find(k); }
+			size_type		count(const key_type& k) const { return _p.get().count(k); }
+			iterator		lower_bound(const key_type& k) { return _p.leak().lower_bound(k); }
+			const_iterator	lower_bound(const key_type& k) const { return _p.get().lower_bound(k); }
+			iterator		upper_bound(const key_type& k) { return _p.leak().upper_bound(k); }
+			const_iterator	upper_bound(const key_type& k) const { return _p.get().upper_bound(k); }
+
+			pair<iterator, iterator>				equal_range(const key_type& k) { return _p.leak().equal_range(k); }
+			pair<const_iterator, const_iterator>	equal_range(const key_type& k) const { return _p.get().equal_range(k); }
+	};
+
+	_HEADER_COW_MAP
+	inline bool	operator==(const cow_map<Key, T, Compare, Alloc>& x, const cow_map<Key, T, Compare, Alloc>& y)
+	{ return x.base() == y.base(); }
+
+	_HEADER_COW_MAP
+	inline bool	operator<(const cow_map<Key, T, Compare, Alloc>& x, const cow_map<Key, T, Compare, Alloc>& y)
+	{ return x.base() < y.base(); }
+
+	_HEADER_COW_MAP
+	inline bool	operator!=(const cow_map<Key, T, Compare, Alloc>& x, const cow_map<Key, T, Compare, Alloc>& y)
+	{ return !(x == y); }
+
+	_HEADER_COW_MAP
+	inline bool	operator>(const cow_map<Key, T, Compare, Alloc>& x, const cow_map<Key, T, Compare, Alloc>& y)
+	{ return y < x; }
+
+	_HEADER_COW_MAP
+	inline bool	operator>=(const cow_map<Key, T, Compare, Alloc>& x, const cow_map<Key, T, Compare, Alloc>& y)
+	{ return !(x < y); }
+
+	_HEADER_COW_MAP
+	inline bool	operator<=(const cow_map<Key, T, Compare, Alloc>& x, const cow_map<Key, T, Compare, Alloc>& y)
+	{ return !(y < x); }
+
+	_HEADER_COW_MAP
+	void	swap(cow_map<Key, T, Compare, Alloc>& x, cow_map<Key, T, Compare, Alloc>& y)
+	{ x.swap(y); }
+
+}//namespace
+
+#endif
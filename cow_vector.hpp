@@ -0,0 +1,144 @@
+#pragma once
+# ifndef COW_VECTOR_HPP
+# define COW_VECTOR_HPP
+
+# include "cow_base.hpp"
+# include "vector.hpp"
+
+namespace ft {
+
+	// ft::vector whose copies are O(1) and share the elements until one
+	// of them is modified. Every non-const member, begin() and operator[]
+	// included, first takes a private copy if the elements are shared:
+	// read through a const reference to keep sharing.
+	template <typename T, typename Alloc = std::allocator<T> >
+	class	cow_vector {
+
+		public:
+			typedef ft::vector<T, Alloc>						vector_type;
+			typedef typename vector_type::value_type			value_type;
+			typedef typename vector_type::reference				reference;
+			typedef typename vector_type::const_reference		const_reference;
+			typedef typename vector_type::pointer				pointer;
+			typedef typename vector_type::const_pointer			const_pointer;
+			typedef typename vector_type::iterator				iterator;
+			typedef typename vector_type::const_iterator		const_iterator;
+			typedef typename vector_type::reverse_iterator		reverse_iterator;
+			typedef typename vector_type::const_reverse_iterator	const_reverse_iterator;
+			typedef typename vector_type::difference_type		difference_type;
+			typedef typename vector_type::size_type				size_type;
+			typedef Alloc										allocator_type;
+
+		private:
+			Cow_ptr<vector_type, Alloc>	_p;
+
+		public:
+			//Constructors
+			explicit cow_vector(const Alloc& alloc = allocator_type()) : _p(vector_type(alloc)) {}
+
+			explicit cow_vector(size_type n, const value_type& val = value_type(), const allocator_type& alloc = allocator_type())
+			: _p(vector_type(n, val, alloc)) {}
+
+			template <typename InputIterator>
+			cow_vector(InputIterator first, InputIterator last, const allocator_type& alloc = allocator_type())
+			: _p(vector_type(first, last, alloc)) {}
+
+			explicit cow_vector(const vector_type& x) : _p(x) {}
+
+			cow_vector(const cow_vector& x) : _p(x._p) {}
+
+			~cow_vector() {}
+
+			cow_vector&	operator=(const cow_vector& x) {
+				_p = x._p;
+				return *this;
+			}
+
+			// The shared elements, no copy is taken.
+			const vector_type&	base() const { return _p.get(); }
+			bool				unique() const { return _p.unique(); }
+
+			//Iterators
+			iterator				begin() { return _p.leak().begin(); }
+			const_iterator			begin() const { return _p.get().begin(); }
+			iterator				end() { return _p.leak().end(); }
+			const_iterator			end() const { return _p.get().end(); }
+			reverse_iterator		rbegin() { return _p.leak().rbegin(); }
+			const_reverse_iterator	rbegin() const { return _p.get().rbegin(); }
+			reverse_iterator		rend() { return _p.leak().rend(); }
+			const_reverse_iterator	rend() const { return _p.get().rend(); }
+
+			//Capacity
+			size_type	size() const { return _p.get().size(); }
+			size_type	max_size() const { return _p.get().max_size(); }
+			bool		empty() const { return _p.get().empty(); }
+			size_type	capacity() const { return _p.get().capacity(); }
+			void		resize(size_type n, value_type val = value_type()) { _p.write().resize(n, val); }
+			void		reserve(size_type n) { _p.write().reserve(n); }
+
+			//Element access
+			reference		at(size_type n) { return _p.leak().at(n); }
+			const_reference	at(size_type n) const { return _p.get().at(n); }
+			reference		operator[](size_type n) { return _p.leak()[n]; }
+			const_reference	operator[](size_type n) const { return _p.get()[n]; }
+			reference		front() { return _p.leak().front(); }
+			const_reference	front() const { return _p.get().front(); }
+			reference		back() { return _p.leak().back(); }
+			const_reference	back() const { return _p.get().back(); }
+
+			//Modifiers
+			// position comes from a non-const begin() or end(), which already
+			// detached the elements.
+			iterator	insert(iterator position, const value_type& val) { return _p.leak().insert(position, val); }
+			void		insert(iterator position, size_type n, const value_type& val) { _p.write().insert(position, n, val); }
+			template <typename InputIterator>
+			void		insert(iterator position, InputIterator first, InputIterator last) { _p.write().insert(position, first, last); }
+
+			template <typename InputIterator>
+			void	assign(InputIterator first, InputIterator last) { _p.write().assign(first, last); }
+			void	assign(size_type n, const value_type& val) { _p.write().assign(n, val); }
+
+			void	push_back(const value_type& val) { _p.write().push_back(val); }
+			void	pop_back() { _p.write().pop_back(); }
+
+			iterator	erase(iterator position) { return _p.leak().erase(position); }
+			iterator	erase(iterator first, iterator last) { return _p.leak().erase(first, last); }
+
+			void	swap(cow_vector& x) { _p.swap(x._p); }
+			void	clear() { _p.reset(vector_type(get_allocator())); }
+
+			//Allocator
+			allocator_type	get_allocator() const { return _p.get().get_allocator(); }
+	};
+
+	template <typename T, typename Alloc>
+	bool	operator==(const cow_vector<T,Alloc>& x, const cow_vector<T,Alloc>& y)
+	{ return x.base() == y.base(); }
+
+	template <typename T, typename Alloc>
+	bool	operator<(const cow_vector<T,Alloc>& x, const cow_vector<T,Alloc>& y)
+	{ return x.base() < y.base(); }
+
+	template <typename T, typename Alloc>
+	bool	operator!=(const cow_vector<T,Alloc>& x, const cow_vector<T,Alloc>& y)
+	{ return !(x == y); }
+
+	template <typename T, typename Alloc>
+	bool	operator<=(const cow_vector<T,Alloc>& x, const cow_vector<T,Alloc>& y)
+	{ return !(y < x); }
+
+	template <typename T, typename Alloc>
+	bool	operator>(const cow_vector<T,Alloc>& x, const cow_vector<T,Alloc>& y)
+	{ return (y < x); }
+
+	template <typename T, typename Alloc>
+	bool	operator>=(const cow_vector<T,Alloc>& x, const cow_vector<T,Alloc>& y)
+	{ return !(x < y); }
+
+	template <typename T, typename Alloc>
+	void	swap(cow_vector<T, Alloc>& x, cow_vector<T, Alloc>& y)
+	{ x.swap(y); }
+
+}
+
+#endif
@@ -0,0 +1,113 @@
+#pragma once
+# ifndef EPOCH_HPP
+# define EPOCH_HPP
+
+# include <stdexcept>
+# include "concurrent_base.hpp"
+
+namespace ft {
+
+	// Epoch based reclamation shared by every structure of the process.
+	// A reader pins the current epoch in its own slot for the duration of
+	// a read, a writer that unlinked an object at epoch e may free it once
+	// no slot is pinned at an epoch <= e.
+	class	Epoch_domain {
+
+		public:
+			enum { max_threads = 512 };
+
+			static Epoch_domain&	instance() {
+				static Epoch_domain	domain;
+				return domain;
+			}
+
+			uint64_t	current() const { return _global.value.load(std::memory_order_acquire); }
+
+			// Publishing writers call this after the new version is visible,
+			// the returned epoch is the one to retire the old version with.
+			uint64_t	advance() { return _global.value.fetch_add(1, std::memory_order_seq_cst); }
+
+			// True when nothing pinned at an epoch <= e can still be running.
+			bool	quiescent_since(uint64_t e) const {
+				for (size_t i = 0; i < max_threads; ++i) {
+					const uint64_t	pinned = _slots[i].value.load(std::memory_order_seq_cst);
+					if (pinned != 0 && pinned <= e)
+						return false;
+				}
+				return true;
+			}
+
+			// The outermost pin of a thread costs a thread_local lookup, a
+			// relaxed store to its slot and a seq_cst fence; nested pins
+			// only count.
+			void	pin() {
+				Thread_slot&	t = _thread_slot();
+
+				if (t.depth++ == 0) {
+					_slots[t.index].value.store(current(), std::memory_order_relaxed);
+					// pairs with the seq_cst publish + scan of writers
+					std::atomic_thread_fence(std::memory_order_seq_cst);
+				}
+			}
+
+			void	unpin() {
+				Thread_slot&	t = _thread_slot();
+
+				if (--t.depth == 0)
+					_slots[t.index].value.store(0, std::memory_order_release);
+			}
+
+		private:
+			Epoch_domain() {
+				_global.value.store(1, std::memory_order_relaxed);
+				for (size_t i = 0; i < max_threads; ++i)
+					_used[i].store(false, std::memory_order_relaxed);
+			}
+
+			Epoch_domain(const Epoch_domain&) = delete;
+			Epoch_domain&	operator=(const Epoch_domain&) = delete;
+
+			// A thread claims a slot on its first pin and frees it on exit.
+			struct	Thread_slot {
+				size_t		index;
+				unsigned	depth;
+
+				Thread_slot() : index(Epoch_domain::instance()._claim()), depth(0) {}
+				~Thread_slot() { Epoch_domain::instance()._used[index].store(false, std::memory_order_release); }
+			};
+
+			static Thread_slot&	_thread_slot() {
+				static thread_local Thread_slot	slot;
+				return slot;
+			}
+
+			size_t	_claim() {
+				for (size_t i = 0; i < max_threads; ++i) {
+					bool	expected = false;
+					if (!_used[i].load(std::memory_order_relaxed)
+						&& _used[i].compare_exchange_strong(expected, true, std::memory_order_acquire))
+						return i;
+				}
+				throw std::length_error("Epoch_domain: too many reader threads");
+			}
+
+			cache_padded<std::atomic<uint64_t> >	_global;
+			cache_padded<std::atomic<uint64_t> >	_slots[max_threads];
+			std::atomic<bool>						_used[max_threads];
+	};
+
+	// Scoped pin of the calling thread.
+	class	epoch_guard {
+
+		public:
+			epoch_guard() { Epoch_domain::instance().pin(); }
+			~epoch_guard() { Epoch_domain::instance().unpin(); }
+
+		private:
+			epoch_guard(const epoch_guard&) = delete;
+			epoch_guard&	operator=(const epoch_guard&) = delete;
+	};
+
+}//namespace
+
+#endif
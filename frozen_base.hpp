@@ -0,0 +1,332 @@
+#pragma once
+# ifndef FROZEN_BASE_HPP
+# define FROZEN_BASE_HPP
+
+# include <algorithm>
+# include <memory>
+# include "algorithm.hpp"
+# include "iterator.hpp"
+# include "utility.hpp"
+
+namespace ft {
+
+	// In-order walk over an Eytzinger array: slot i has its children in
+	// 2i and 2i + 1, slot 0 is unused and stands for end().
+	template <typename Val>
+	struct	Frozen_iterator {
+		typedef Val							value_type;
+		typedef const Val&					reference;
+		typedef const Val*					pointer;
+		typedef ptrdiff_t					difference_type;
+		typedef bidirectional_iterator_tag	iterator_category;
+		typedef Frozen_iterator<Val>		Self;
+		typedef size_t						size_type;
+
+		Frozen_iterator() : _a(0), _i(0), _n(0) {}
+
+		Frozen_iterator(const Val* a, size_type i, size_type n) : _a(a), _i(i), _n(n) {}
+
+		reference	operator*() const { return _a[_i]; }
+		pointer		operator->() const { return _a + _i; }
+
+		Self&	operator++() {
+			if (2 * _i + 1 <= _n) {
+				_i = 2 * _i + 1;
+				while (2 * _i <= _n)
+					_i = 2 * _i;
+			}
+			else {
+				// climb the right turns, the root counting as one
+				while (_i & 1)
+					_i >>= 1;
+				_i >>= 1;
+			}
+			return *this;
+		}
+
+		Self	operator++(int) {
+			Self	tmp = *this;
+			this->operator++();
+			return tmp;
+		}
+
+		Self&	operator--() {
+			if (_i == 0) {
+				_i = _n != 0;
+				while (2 * _i + 1 <= _n)
+					_i = 2 * _i + 1;
+			}
+			else if (2 * _i <= _n) {
+				_i = 2 * _i;
+				while (2 * _i + 1 <= _n)
+					_i = 2 * _i + 1;
+			}
+			else {
+				while (!(_i & 1))
+					_i >>= 1;
+				_i >>= 1;
+			}
+			return *this;
+		}
+
+		Self	operator--(int) {
+			Self	tmp = *this;
+			this->operator--();
+			return tmp;
+		}
+
+		bool	operator==(const Self& x) const { return _i == x._i; }
+		bool	operator!=(const Self& x) const { return _i != x._i; }
+
+		const Val*	_a;
+		size_type	_i;
+		size_type	_n;
+	};
+
+	// Read-only sorted array of unique keys in Eytzinger (breadth-first)
+	// order: the first levels of every search share a few cache lines and
+	// there is no per-key pointer. Lookups descend without branching on
+	// the comparison and prefetch the descendants a cache line below.
+	template <typename Key, typename Val, typename KeyOfValue, typename Compare, typename Alloc = std::allocator<Val> >
+	class	Frozen_tree {
+
+		public:
+			typedef typename Alloc::template rebind<Val>::other	Val_allocator;
+
+			typedef Key											key_type;
+			typedef Val											value_type;
+			typedef const value_type&							const_reference;
+			typedef size_t										size_type;
+			typedef ptrdiff_t									difference_type;
+			typedef Alloc										allocator_type;
+			typedef Frozen_iterator<value_type>					const_iterator;
+			typedef ft::reverse_iterator<const_iterator>		const_reverse_iterator;
+
+		private:
+			// Levels between a slot and the descendants worth prefetching:
+			// as many as fit a cache line, two at least.
+			enum { _ahead = sizeof(Val) <= 4 ? 4 : sizeof(Val) <= 8 ? 3 : 2 };
+
+		public:
+			Frozen_tree(const Compare& comp, const allocator_type& a)
+			: _alloc(a), _key_compare(comp), _a(0), _n(0), _height(0) {}
+
+			// [first, last) must be sorted and free of duplicates, as an
+			// ft::set or ft::map is.
+			template <typename ForwardIterator>
+			Frozen_tree(ForwardIterator first, ForwardIterator last, const Compare& comp, const allocator_type& a)
+			: _alloc(a), _key_compare(comp), _a(0), _n(0), _height(0) {
+				size_type	n = 0;
+				size_type	built = 0;
+
+				for (ForwardIterator it = first; it != last; ++it)
+					++n;
+				if (n == 0)
+					return ;
+				_a = _alloc.allocate(n + 1);
+				_n = n;
+				try {
+					_fill(first, 1, built);
+				}
+				catch (...) {
+					const_iterator	it = begin();
+
+					for (; built != 0; --built)
+						_alloc.destroy(_a + (it++)._i);
+					_alloc.deallocate(_a, _n + 1);
+					throw ;
+				}
+				while ((size_type(2) << _height) <= _n)
+					++_height;
+			}
+
+			Frozen_tree(const Frozen_tree& x)
+			: _alloc(x._alloc), _key_compare(x._key_compare), _a(0), _n(0), _height(0) {
+				_copy(x);
+			}
+
+			~Frozen_tree() { _release(); }
+
+			Frozen_tree&	operator=(const Frozen_tree& x) {
+				if (this != &x) {
+					Frozen_tree	tmp(x);
+
+					swap(tmp);
+				}
+				return *this;
+			}
+
+			void	swap(Frozen_tree& x) {
+				std::swap(_alloc, x._alloc);
+				std::swap(_key_compare, x._key_compare);
+				std::swap(_a, x._a);
+				std::swap(_n, x._n);
+				std::swap(_height, x._height);
+			}
+
+			allocator_type	get_allocator() const { return _alloc; }
+			Compare			key_comp() const { return _key_compare; }
+
+			const_iterator			begin() const {
+				size_type	i = 1;
+
+				if (_n == 0)
+					return end();
+				while (2 * i <= _n)
+					i = 2 * i;
+				return const_iterator(_a, i, _n);
+			}
+			const_iterator			end() const { return const_iterator(_a, 0, _n); }
+			const_reverse_iterator	rbegin() const { return const_reverse_iterator(end()); }
+			const_reverse_iterator	rend() const { return const_reverse_iterator(begin()); }
+
+			bool		empty() const { return _n == 0; }
+			size_type	size() const { return _n; }
+			size_type	max_size() const { return _alloc.max_size() - 1; }
+
+			// The descent goes right past every key below k and ends under a
+			// leaf; the answer is the slot where it last went left.
+			const_iterator	lower_bound(const key_type& k) const {
+				size_type	i = 1;
+
+				while (i <= _n) {
+					_prefetch(i);
+					i = 2 * i + _key_compare(KeyOfValue()(_a[i]), k);
+				}
+				return const_iterator(_a, _last_left(i), _n);
+			}
+
+			const_iterator	upper_bound(const key_type& k) const {
+				size_type	i = 1;
+
+				while (i <= _n) {
+					_prefetch(i);
+					i = 2 * i + !_key_compare(k, KeyOfValue()(_a[i]));
+				}
+				return const_iterator(_a, _last_left(i), _n);
+			}
+
+			const_iterator	find(const key_type& k) const {
+				const_iterator	it = lower_bound(k);
+
+				if (it._i == 0 || _key_compare(k, KeyOfValue()(_a[it._i])))
+					return end();
+				return it;
+			}
+
+			pair<const_iterator, const_iterator>	equal_range(const key_type& k) const {
+				const_iterator	first = lower_bound(k);
+				const_iterator	last = first;
+
+				if (first._i != 0 && !_key_compare(k, KeyOfValue()(_a[first._i])))
+					++last;
+				return pair<const_iterator, const_iterator>(first, last);
+			}
+
+			// Number of keys below k. Same descent as lower_bound, adding up
+			// the left subtrees and the slots it passes on the right.
+			size_type	rank(const key_type& k) const {
+				size_type	r = 0;
+				size_type	i = 1;
+				size_type	h = _height;
+
+				while (i <= _n) {
+					bool	right = _key_compare(KeyOfValue()(_a[i]), k);
+
+					_prefetch(i);
+					r += right * (_left_size(i, h) + 1);
+					i = 2 * i + right;
+					--h;
+				}
+				return r;
+			}
+
+		private:
+			// Slots are filled in order, so the input is read once.
+			template <typename ForwardIterator>
+			void	_fill(ForwardIterator& it, size_type i, size_type& built) {
+				if (i > _n)
+					return ;
+				_fill(it, 2 * i, built);
+				_alloc.construct(_a + i, *it);
+				++it;
+				++built;
+				_fill(it, 2 * i + 1, built);
+			}
+
+			void	_copy(const Frozen_tree& x) {
+				size_type	i = 1;
+
+				if (x._n == 0)
+					return ;
+				_a = _alloc.allocate(x._n + 1);
+				try {
+					for (; i <= x._n; ++i)
+						_alloc.construct(_a + i, x._a[i]);
+				}
+				catch (...) {
+					while (--i != 0)
+						_alloc.destroy(_a + i);
+					_alloc.deallocate(_a, x._n + 1);
+					_a = 0;
+					throw ;
+				}
+				_n = x._n;
+				_height = x._height;
+			}
+
+			void	_release() {
+				if (_a == 0)
+					return ;
+				for (size_type i = 1; i <= _n; ++i)
+					_alloc.destroy(_a + i);
+				_alloc.deallocate(_a, _n + 1);
+			}
+
+			// The address is only a hint and may lie past the array.
+			void	_prefetch(size_type i) const {
+				FT_PREFETCH(reinterpret_cast<const char*>(_a) + (i << _ahead) * sizeof(Val));
+			}
+
+			// Drops the trailing right turns and the left turn above them.
+			static size_type	_last_left(size_type i) {
+# ifdef __GNUC__
+				return i >> __builtin_ffsl(static_cast<long>(~i));
+# else
+				while (i & 1)
+					i >>= 1;
+				return i >> 1;
+# endif
+			}
+
+			// Size of the left subtree of slot i, h levels above the last
+			// one. The tree is complete: full but for its last level, which
+			// fills from the left.
+			size_type	_left_size(size_type i, size_type h) const {
+				if (h == 0)
+					return 0;
+				size_type	width = size_type(1) << (h - 1);
+				size_type	first = (2 * i) << (h - 1);
+				size_type	last = _n < first ? 0 : std::min(_n - first + 1, width);
+
+				return width - 1 + last;
+			}
+
+			Val_allocator	_alloc;
+			Compare			_key_compare;
+			Val*			_a;
+			size_type		_n;
+			size_type		_height;
+	};
+
+	template <typename Key, typename Val, typename KeyOfValue, typename Compare, typename Alloc>
+	inline bool	operator==(const Frozen_tree<Key, Val, KeyOfValue, Compare, Alloc>& x, const Frozen_tree<Key, Val, KeyOfValue, Compare, Alloc>& y)
+	{ return x.size() == y.size() && ft::equal(x.begin(), x.end(), y.begin()); }
+
+	template <typename Key, typename Val, typename KeyOfValue, typename Compare, typename Alloc>
+	inline bool	operator<(const Frozen_tree<Key, Val, KeyOfValue, Compare, Alloc>& x, const Frozen_tree<Key, Val, KeyOfValue, Compare, Alloc>& y)
+	{ return ft::lexicographical_compare(x.begin(), x.end(), y.begin(), y.end()); }
+
+}//namespace
+
+#endif
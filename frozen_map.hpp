@@ -0,0 +1,149 @@
+#pragma once
+# ifndef FROZEN_MAP_HPP
+# define FROZEN_MAP_HPP
+
+# include <stdexcept>
+# include "frozen_base.hpp"
+# include "functional.hpp"
+# include "map.hpp"
+
+namespace ft {
+
+# define _HEADER_FROZEN_MAP \
+		template <typename Key, typename T, typename Compare, typename Alloc>
+
+	// Read-only map built once from pairs sorted by unique key, see
+	// Frozen_tree. The pairs are stored whole, so the smaller the mapped
+	// type the more keys a cache line holds.
+	template <class Key, class T, class Compare = ft::less<Key>, class Alloc = std::allocator<pair<const Key, T> > >
+	class	frozen_map {
+
+		public:
+			typedef Key					key_type;
+			typedef T					mapped_type;
+			typedef pair<const Key, T>	value_type;
+			typedef Compare				key_compare;
+			typedef Alloc				allocator_type;
+
+			class	value_compare : public binary_function<value_type, value_type, bool> {
+				friend class frozen_map;
+				protected:
+					Compare	comp;
+					value_compare(Compare c) : comp(c) {}
+				public:
+					bool	operator()(const value_type& x, const value_type& y) const {
+						return comp(x.first, y.first);
+					}
+			};
+
+		private:
+			typedef Frozen_tree<key_type, value_type, select1st<value_type>, key_compare, allocator_type>	Tree;
+
+			Tree	_t;
+
+		public:
+			typedef typename Alloc::reference				reference;
+			typedef typename Alloc::const_reference			const_reference;
+			typedef typename Alloc::pointer					pointer;
+			typedef typename Alloc::const_pointer			const_pointer;
+			typedef typename Tree::const_iterator			iterator;
+			typedef typename Tree::const_iterator			const_iterator;
+			typedef typename Tree::const_reverse_iterator	reverse_iterator;
+			typedef typename Tree::const_reverse_iterator	const_reverse_iterator;
+			typedef typename Tree::difference_type			difference_type;
+			typedef typename Tree::size_type				size_type;
+
+			explicit frozen_map(const Compare& comp = key_compare(), const allocator_type& alloc = allocator_type()) : _t(comp, alloc) {}
+			// [first, last) must be sorted by key and free of duplicate keys.
+			template <class ForwardIterator>
+			frozen_map(ForwardIterator first, ForwardIterator last, const Compare& comp = key_compare(), const allocator_type& alloc = allocator_type()) : _t(first, last, comp, alloc) {}
+			frozen_map(const frozen_map& x) : _t(x._t) {}
+			~frozen_map() {}
+
+			frozen_map&	operator=(const frozen_map& x) {
+				_t = x._t;
+				return *this;
+			}
+
+			allocator_type	get_allocator() const { return _t.get_allocator(); }
+
+			//iterators
+			const_iterator			begin() const { return _t.begin(); }
+			const_iterator			end() const { return _t.end(); }
+			const_reverse_iterator	rbegin() const { return _t.rbegin(); }
+			const_reverse_iterator	rend() const { return _t.rend(); }
+
+			//capacity
+			bool		empty() const { return _t.empty(); }
+			size_type	size() const { return _t.size(); }
+			size_type	max_size() const { return _t.max_size(); }
+
+			//element access
+			const mapped_type&	at(const key_type& k) const {
+				const_iterator	it = _t.find(k);
+
+				if (it == _t.end())
+					throw std::out_of_range("frozen_map::at");
+				return it->second;
+			}
+
+			//modifiers
+			void	swap(frozen_map& x) { _t.swap(x._t); }
+
+			//observers
+			key_compare		key_comp() const { return _t.key_comp(); }
+			value_compare	value_comp() const { return value_compare(_t.key_comp()); }
+
+			//operations
+			const_iterator	find(const key_type& k) const { return _t.find(k); }
+			size_type		count(const key_type& k) const { return _t.find(k) == _t.end() ? 0 : 1; }
+			bool			contains(const key_type& k) const { return _t.find(k) != _t.end(); }
+			const_iterator	lower_bound(const key_type& k) const { return _t.lower_bound(k); }
+			const_iterator	upper_bound(const key_type& k) const { return _t.upper_bound(k); }
+			pair<const_iterator, const_iterator>	equal_range(const key_type& k) const { return _t.equal_range(k); }
+			// Number of keys below k.
+			size_type		rank(const key_type& k) const { return _t.rank(k); }
+
+			template <typename K1, typename T1, typename C1, typename A1>
+			friend bool	operator==(const frozen_map<K1, T1, C1, A1>&, const frozen_map<K1, T1, C1, A1>&);
+
+			template <typename K1, typename T1, typename C1, typename A1>
+			friend bool	operator<(const frozen_map<K1, T1, C1, A1>&, const frozen_map<K1, T1, C1, A1>&);
+	};
+
+	_HEADER_FROZEN_MAP
+	inline bool	operator==(const frozen_map<Key, T, Compare, Alloc>& x, const frozen_map<Key, T, Compare, Alloc>& y)
+	{ return x._t == y._t; }
+
+	_HEADER_FROZEN_MAP
+	inline bool	operator<(const frozen_map<Key, T, Compare, Alloc>& x, const frozen_map<Key, T, Compare, Alloc>& y)
+	{ return x._t < y._t; }
+
+	_HEADER_FROZEN_MAP
+	inline bool	operator!=(const frozen_map<Key, T, Compare, Alloc>& x, const frozen_map<Key, T, Compare, Alloc>& y)
+	{ return !(x == y); }
+
+	_HEADER_FROZEN_MAP
+	inline bool	operator>(const frozen_map<Key, T, Compare, Alloc>& x, const frozen_map<Key, T, Compare, Alloc>& y)
+	{ return y < x; }
+
+	_HEADER_FROZEN_MAP
+	inline bool	operator>=(const frozen_map<Key, T, Compare, Alloc>& x, const frozen_map<Key, T, Compare, Alloc>& y)
+	{ return !(x < y); }
+
+	_HEADER_FROZEN_MAP
+	inline bool	operator<=(const frozen_map<Key, T, Compare, Alloc>& x, const frozen_map<Key, T, Compare, Alloc>& y)
+	{ return !(y < x); }
+
+	_HEADER_FROZEN_MAP
+	void	swap(frozen_map<Key, T, Compare, Alloc>& x, frozen_map<Key, T, Compare, Alloc>& y)
+	{ x.swap(y); }
+
+	// Read-only copy of m.
+	template <typename Key, typename T, typename Compare, typename Alloc, typename Cache, typename Balance>
+	frozen_map<Key, T, Compare, Alloc>	freeze(const map<Key, T, Compare, Alloc, Cache, Balance>& m)
+	{ return frozen_map<Key, T, Compare, Alloc>(m.begin(), m.end(), m.key_comp(), m.get_allocator()); }
+
+}//namespace
+
+#endif
@@ -0,0 +1,122 @@
+#pragma once
+# ifndef FROZEN_SET_HPP
+# define FROZEN_SET_HPP
+
+# include "frozen_base.hpp"
+# include "functional.hpp"
+# include "set.hpp"
+
+namespace ft {
+
+# define _HEADER_FROZEN_SET \
+	template <typename T, typename Compare, typename Alloc>
+
+	// Read-only set built once from sorted unique keys, see Frozen_tree.
+	// Lookups touch a contiguous array instead of chasing nodes; rank()
+	// counts the keys below a value in the same descent.
+	template <typename Key, typename Compare = less<Key>, typename Alloc = std::allocator<Key> >
+	class	frozen_set {
+
+		public:
+			typedef Key								key_type;
+			typedef Key								value_type;
+			typedef Compare							key_compare;
+			typedef Compare							value_compare;
+			typedef Alloc							allocator_type;
+			typedef typename Alloc::reference		reference;
+			typedef typename Alloc::const_reference	const_reference;
+			typedef typename Alloc::pointer			pointer;
+			typedef typename Alloc::const_pointer	const_pointer;
+
+		private:
+			typedef Frozen_tree<key_type, value_type, Identity<value_type>, key_compare, Alloc>	Tree;
+
+			Tree	_t;
+
+		public:
+			typedef typename Tree::const_iterator			iterator;
+			typedef typename Tree::const_iterator			const_iterator;
+			typedef typename Tree::const_reverse_iterator	reverse_iterator;
+			typedef typename Tree::const_reverse_iterator	const_reverse_iterator;
+			typedef size_t									size_type;
+			typedef ptrdiff_t								difference_type;
+
+			explicit	frozen_set(const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type()) : _t(comp, alloc) {}
+			// [first, last) must be sorted by comp and free of duplicates.
+			template <typename ForwardIterator>
+			frozen_set(ForwardIterator first, ForwardIterator last, const key_compare& comp = key_compare(), const allocator_type& alloc = allocator_type()) : _t(first, last, comp, alloc) {}
+			frozen_set(const frozen_set& x) : _t(x._t) {}
+			~frozen_set() {}
+
+			frozen_set&	operator=(const frozen_set& x) {
+				_t = x._t;
+				return *this;
+			}
+
+			//iterators
+			const_iterator			begin() const { return _t.begin(); }
+			const_iterator			end() const { return _t.end(); }
+			const_reverse_iterator	rbegin() const { return _t.rbegin(); }
+			const_reverse_iterator	rend() const { return _t.rend(); }
+
+			//capacity
+			bool		empty() const { return _t.empty(); }
+			size_type	size() const { return _t.size(); }
+			size_type	max_size() const { return _t.max_size(); }
+
+			//modifiers
+			void	swap(frozen_set& x) { _t.swap(x._t); }
+
+			//observers
+			key_compare		key_comp() const { return _t.key_comp(); }
+			value_compare	value_comp() const { return _t.key_comp(); }
+			allocator_type	get_allocator() const { return _t.get_allocator(); }
+
+			//operations
+			iterator	find(const value_type& val) const { return _t.find(val); }
+			size_type	count(const value_type& val) const { return _t.find(val) == _t.end() ? 0 : 1; }
+			bool		contains(const value_type& val) const { return _t.find(val) != _t.end(); }
+			iterator	lower_bound(const value_type& val) const { return _t.lower_bound(val); }
+			iterator	upper_bound(const value_type& val) const { return _t.upper_bound(val); }
+			pair<iterator, iterator>
+			equal_range(const value_type& val) const { return _t.equal_range(val); }
+			// Number of values below val.
+			size_type	rank(const value_type& val) const { return _t.rank(val); }
+
+		template <typename K1, typename C1, typename A1>
+		friend bool	operator==(const frozen_set<K1, C1, A1>&, const frozen_set<K1, C1, A1>&);
+
+		template <typename K1, typename C1, typename A1>
+		friend bool	operator<(const frozen_set<K1, C1, A1>&, const frozen_set<K1, C1, A1>&);
+
+	};
+
+	_HEADER_FROZEN_SET
+	inline bool	operator==(const frozen_set<T,Compare,Alloc>& x, const frozen_set<T,Compare,Alloc>& y) { return x._t == y._t; }
+
+	_HEADER_FROZEN_SET
+	inline bool	operator<(const frozen_set<T,Compare,Alloc>& x, const frozen_set<T,Compare,Alloc>& y) { return x._t < y._t; }
+
+	_HEADER_FROZEN_SET
+	inline bool	operator!=(const frozen_set<T,Compare,Alloc>& x, const frozen_set<T,Compare,Alloc>& y) { return !(x == y); }
+
+	_HEADER_FROZEN_SET
+	inline bool	operator<=(const frozen_set<T,Compare,Alloc>& x, const frozen_set<T,Compare,Alloc>& y) { return !(y < x); }
+
+	_HEADER_FROZEN_SET
+	inline bool	operator>(const frozen_set<T,Compare,Alloc>& x, const frozen_set<T,Compare,Alloc>& y) { return y < x; }
+
+	_HEADER_FROZEN_SET
+	inline bool	operator>=(const frozen_set<T,Compare,Alloc>& x, const frozen_set<T,Compare,Alloc>& y) { return !(x < y); }
+
+	_HEADER_FROZEN_SET
+	inline void	swap(frozen_set<T, Compare, Alloc>& x, frozen_set<T, Compare, Alloc>& y) { x.swap(y); }
+
+	// Read-only copy of s.
+	template <typename T, typename Compare, typename Alloc, typename Cache, typename Balance>
+	frozen_set<T, Compare, Alloc>	freeze(const set<T, Compare, Alloc, Cache, Balance>& s)
+	{ return frozen_set<T, Compare, Alloc>(s.begin(), s.end(), s.key_comp(), s.get_allocator()); }
+
+}//namespace
+
+#endif
@@ -2,6 +2,9 @@
 # ifndef FUNCTIONAL_HPP
 # define FUNCTIONAL_HPP
 
+# include <cstddef>
+# include "type_traits.hpp"
+
 namespace ft {
 
 	template <class Arg, class Result>
@@ -24,6 +27,91 @@ namespace ft {
 		}
 	};
 
+	template <class T>
+	struct	equal_to : binary_function <T, T, bool> {
+		bool	operator() (const T& x, const T& y) const {
+			return x == y;
+		}
+	};
+
+	// A comparator may also provide int compare(const T&, const T&) const,
+	// negative, zero or positive as x is below, equal to or above y.
+	// Rb_tree then settles each node with one call instead of two.
+	template <typename Compare, typename T>
+	struct	Three_way_helper {
+		typedef char	yes;
+		typedef char	(&no)[2];
+
+		template <typename C, int (C::*)(const T&, const T&) const>
+		struct	Check;
+
+		template <typename C>
+		static yes	test(Check<C, &C::compare>*);
+		template <typename C>
+		static no	test(...);
+
+		static const bool	value = sizeof(test<Compare>(0)) == sizeof(yes);
+	};
+
+	template <typename Compare, typename T>
+	struct	has_three_way
+	: public integral_constant<bool, Three_way_helper<Compare, T>::value> {};
+
+	// Filled by counting_compare.
+	struct	compare_stats {
+		compare_stats() : calls(0) {}
+
+		size_t	calls;
+	};
+
+	// Counts the calls made to Compare in *stats, to check what an
+	// operation costs in comparisons. compare() is kept if Compare has it.
+	template <typename Compare, typename T, bool = has_three_way<Compare, T>::value>
+	struct	counting_compare : binary_function<T, T, bool> {
+		counting_compare() : comp(), stats(0) {}
+		explicit counting_compare(compare_stats* s, const Compare& c = Compare()) : comp(c), stats(s) {}
+
+		bool	operator()(const T& x, const T& y) const {
+			_count();
+			return comp(x, y);
+		}
+
+		void	_count() const {
+			if (stats != 0)
+				++stats->calls;
+		}
+
+		Compare			comp;
+		compare_stats*	stats;
+	};
+
+	template <typename Compare, typename T>
+	struct	counting_compare<Compare, T, true> : counting_compare<Compare, T, false> {
+		typedef counting_compare<Compare, T, false>	Base;
+
+		counting_compare() : Base() {}
+		explicit counting_compare(compare_stats* s, const Compare& c = Compare()) : Base(s, c) {}
+
+		int	compare(const T& x, const T& y) const {
+			this->_count();
+			return this->comp.compare(x, y);
+		}
+	};
+
+	// Hash of integral keys, enums and pointers, for lookup caches. Other
+	// key types need their own functor.
+	template <typename T>
+	struct	hash : unary_function<T, size_t> {
+		size_t	operator()(const T& x) const
+		{ return static_cast<size_t>(x); }
+	};
+
+	template <typename T>
+	struct	hash<T*> : unary_function<T*, size_t> {
+		size_t	operator()(T* p) const
+		{ return reinterpret_cast<size_t>(p); }
+	};
+
 	template <class Pair>
 	struct select1st : public unary_function<Pair, typename Pair::first_type> {
 		typename	Pair::first_type&	operator()(Pair& x) const
@@ -0,0 +1,96 @@
+#pragma once
+# ifndef HEAP_ALGO_HPP
+# define HEAP_ALGO_HPP
+
+# include "iterator_base.hpp"
+
+namespace ft {
+
+	// d-ary max-heap over a random access range, children of i are
+	// [D * i + 1, D * i + D]. Sifts move a hole instead of swapping.
+
+	template <size_t D, typename RandomIt, typename Distance, typename T, typename Compare>
+	void	_heap_sift_up(RandomIt first, Distance hole, const T& val, Compare comp) {
+		while (hole > 0) {
+			const Distance	parent = (hole - 1) / D;
+
+			if (!comp(first[parent], val))
+				break ;
+			first[hole] = first[parent];
+			hole = parent;
+		}
+		first[hole] = val;
+	}
+
+	template <size_t D, typename RandomIt, typename Distance, typename T, typename Compare>
+	void	_heap_sift_down(RandomIt first, Distance hole, Distance len, const T& val, Compare comp) {
+		Distance	child;
+
+		while ((child = D * hole + 1) < len) {
+			const Distance	last = (len - child > Distance(D)) ? child + D : len;
+			Distance		best = child;
+
+			for (++child; child < last; ++child)
+				if (comp(first[best], first[child]))
+					best = child;
+			if (!comp(val, first[best]))
+				break ;
+			first[hole] = first[best];
+			hole = best;
+		}
+		first[hole] = val;
+	}
+
+	// [first, last - 1) is a heap, last - 1 is sifted in.
+	template <size_t D, typename RandomIt, typename Compare>
+	void	push_heap(RandomIt first, RandomIt last, Compare comp) {
+		typedef typename iterator_traits<RandomIt>::difference_type	Distance;
+		typedef typename iterator_traits<RandomIt>::value_type		Value;
+
+		const Distance	hole = (last - first) - 1;
+		if (hole > 0) {
+			const Value	val = first[hole];
+			ft::_heap_sift_up<D>(first, hole, val, comp);
+		}
+	}
+
+	// Moves the top to last - 1, [first, last - 1) stays a heap.
+	template <size_t D, typename RandomIt, typename Compare>
+	void	pop_heap(RandomIt first, RandomIt last, Compare comp) {
+		typedef typename iterator_traits<RandomIt>::difference_type	Distance;
+		typedef typename iterator_traits<RandomIt>::value_type		Value;
+
+		const Distance	len = (last - first) - 1;
+		if (len > 0) {
+			const Value	val = first[len];
+			first[len] = *first;
+			ft::_heap_sift_down<D>(first, Distance(0), len, val, comp);
+		}
+	}
+
+	// Replaces the top by val with a single sift down, cheaper than pop + push.
+	template <size_t D, typename RandomIt, typename T, typename Compare>
+	void	replace_heap_top(RandomIt first, RandomIt last, const T& val, Compare comp) {
+		typedef typename iterator_traits<RandomIt>::difference_type	Distance;
+
+		ft::_heap_sift_down<D>(first, Distance(0), Distance(last - first), val, comp);
+	}
+
+	// Bottom-up (Floyd) construction, O(n).
+	template <size_t D, typename RandomIt, typename Compare>
+	void	make_heap(RandomIt first, RandomIt last, Compare comp) {
+		typedef typename iterator_traits<RandomIt>::difference_type	Distance;
+		typedef typename iterator_traits<RandomIt>::value_type		Value;
+
+		const Distance	len = last - first;
+		if (len < 2)
+			return ;
+		for (Distance parent = (len - 2) / D + 1; parent-- > 0; ) {
+			const Value	val = first[parent];
+			ft::_heap_sift_down<D>(first, parent, len, val, comp);
+		}
+	}
+
+}//namespace
+
+#endif
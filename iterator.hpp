@@ -178,6 +178,7 @@ namespace ft {
 
 			normal_iterator() : _current(Iterator()) {}
 			explicit normal_iterator(const Iterator& i) : _current(i) {}
+			normal_iterator(const normal_iterator& x) : _current(x._current) {}
 
 			//const to normal
 			template <typename Iter>
@@ -0,0 +1,226 @@
+#pragma once
+# ifndef LEARNED_MAP_HPP
+# define LEARNED_MAP_HPP
+
+# include <algorithm>
+# include <memory>
+# include <stdexcept>
+# include "type_traits.hpp"
+# include "utility.hpp"
+# include "vector.hpp"
+
+namespace ft {
+
+	// Knot of the spline: a key and its position in the key array.
+	template <typename Key>
+	struct	Learned_point {
+		Key		key;
+		size_t	pos;
+	};
+
+	template <typename Key>
+	inline bool	operator<(const Key& k, const Learned_point<Key>& p) { return k < p.key; }
+
+	// Read-only map over a sorted array of unique integral keys, with the
+	// mapped values in a parallel array. A radix spline predicts where a
+	// key sits: a radix table on the top bits of the key picks a few knots,
+	// the spline between the two around the key interpolates its position,
+	// and a binary search over max_error slots on each side finishes.
+	// Lookups return positions, size() when the key is absent.
+	template <typename Key, typename T, typename Alloc = std::allocator<pair<const Key, T> > >
+	class	learned_map {
+
+		public:
+			typedef Key									key_type;
+			typedef T									mapped_type;
+			typedef Alloc								allocator_type;
+			typedef size_t								size_type;
+			typedef ptrdiff_t							difference_type;
+
+		private:
+			// Only integral keys have exact differences to interpolate on.
+			typedef typename enable_if<is_integral<Key>::value, size_t>::type	Offset;
+
+			typedef Learned_point<Key>										Point;
+			typedef vector<Key, typename Alloc::template rebind<Key>::other>		Key_vector;
+			typedef vector<T, typename Alloc::template rebind<T>::other>			Value_vector;
+			typedef vector<Point, typename Alloc::template rebind<Point>::other>	Point_vector;
+			typedef vector<size_t, typename Alloc::template rebind<size_t>::other>	Radix_vector;
+
+		public:
+			explicit learned_map(size_type max_error = 32, unsigned radix_bits = 18)
+			: _max_error(max_error), _radix_bits(radix_bits), _shift(0) {}
+
+			// keys must be sorted and free of duplicates, values[i] is the
+			// value of keys[i].
+			learned_map(const Key_vector& keys, const Value_vector& values, size_type max_error = 32, unsigned radix_bits = 18)
+			: _keys(keys), _values(values), _max_error(max_error), _radix_bits(radix_bits), _shift(0) {
+				if (_keys.size() != _values.size())
+					throw std::invalid_argument("learned_map: keys and values differ in size");
+				_build();
+			}
+
+			void	swap(learned_map& x) {
+				_keys.swap(x._keys);
+				_values.swap(x._values);
+				_spline.swap(x._spline);
+				_radix.swap(x._radix);
+				std::swap(_max_error, x._max_error);
+				std::swap(_radix_bits, x._radix_bits);
+				std::swap(_shift, x._shift);
+			}
+
+			//capacity
+			bool		empty() const { return _keys.empty(); }
+			size_type	size() const { return _keys.size(); }
+			size_type	max_error() const { return _max_error; }
+			// Bytes taken by the spline and the radix table.
+			size_type	model_size() const { return _spline.size() * sizeof(Point) + _radix.size() * sizeof(size_t); }
+
+			//element access
+			const key_type&		key(size_type pos) const { return _keys[pos]; }
+			const mapped_type&	value(size_type pos) const { return _values[pos]; }
+
+			const mapped_type&	at(const key_type& k) const {
+				size_type	pos = find(k);
+
+				if (pos == size())
+					throw std::out_of_range("learned_map::at");
+				return _values[pos];
+			}
+
+			//operations
+			// Position of the first key not below k, which is also the
+			// number of keys below k.
+			size_type	lower_bound(const key_type& k) const {
+				size_type	n = _keys.size();
+
+				if (n == 0 || !(_keys[0] < k))
+					return 0;
+				if (_keys[n - 1] < k)
+					return n;
+
+				size_type	guess = _predict(k);
+				size_type	first = guess > _max_error ? guess - _max_error : 0;
+				size_type	last = n - guess - 1 > _max_error ? guess + _max_error + 2 : n;
+				const Key*	base = &_keys[0];
+				size_type	pos = std::lower_bound(base + first, base + last, k) - base;
+
+				// The bound holds for the keys the spline was fit on; rounding
+				// may still push an absent key just out of the window.
+				if ((pos == first && first != 0 && !(base[first - 1] < k))
+					|| (pos == last && last != n && base[last] < k))
+					pos = std::lower_bound(base, base + n, k) - base;
+				return pos;
+			}
+
+			size_type	find(const key_type& k) const {
+				size_type	pos = lower_bound(k);
+
+				if (pos == _keys.size() || k < _keys[pos])
+					return _keys.size();
+				return pos;
+			}
+
+			size_type	count(const key_type& k) const { return find(k) != size(); }
+			bool		contains(const key_type& k) const { return find(k) != size(); }
+
+		private:
+			static double	_delta(const Key& hi, const Key& lo) { return static_cast<double>(static_cast<Offset>(hi) - static_cast<Offset>(lo)); }
+
+			size_type	_prefix(const Key& k) const { return (static_cast<Offset>(k) - static_cast<Offset>(_keys[0])) >> _shift; }
+
+			// Greedy spline corridor: a knot closes the segment once no line
+			// from the previous knot keeps every key since within max_error.
+			void	_build() {
+				size_type	n = _keys.size();
+				size_type	base = 0;
+				double		upper = 0;
+				double		lower = 0;
+				double		e = static_cast<double>(_max_error);
+
+				if (n == 0)
+					return ;
+				_add_point(0);
+				for (size_type i = 1; i < n; ++i) {
+					double	dx = _delta(_keys[i], _keys[base]);
+					double	dy = static_cast<double>(i - base);
+
+					if (i != base + 1 && (dy > upper * dx || dy < lower * dx)) {
+						base = i - 1;
+						_add_point(base);
+						dx = _delta(_keys[i], _keys[base]);
+						dy = 1;
+					}
+					if (i == base + 1) {
+						upper = (dy + e) / dx;
+						lower = (dy - e) / dx;
+					}
+					else {
+						upper = std::min(upper, (dy + e) / dx);
+						lower = std::max(lower, (dy - e) / dx);
+					}
+				}
+				if (base != n - 1)
+					_add_point(n - 1);
+				_build_radix();
+			}
+
+			void	_add_point(size_type pos) {
+				Point	p;
+
+				p.key = _keys[pos];
+				p.pos = pos;
+				_spline.push_back(p);
+			}
+
+			// _radix[p] is the first knot whose prefix is p or more. The table
+			// gets at most twice as many slots as there are knots.
+			void	_build_radix() {
+				Offset		span = static_cast<Offset>(_keys[_keys.size() - 1]) - static_cast<Offset>(_keys[0]);
+				unsigned	bits = 1;
+				size_type	knot = 0;
+
+				while (bits < _radix_bits && (size_type(1) << bits) < 2 * _spline.size())
+					++bits;
+				while ((span >> _shift) >> bits != 0)
+					++_shift;
+				_radix.reserve((span >> _shift) + 2);
+				for (size_type p = 0; p <= (span >> _shift) + 1; ++p) {
+					while (knot < _spline.size() && _prefix(_spline[knot].key) < p)
+						++knot;
+					_radix.push_back(knot);
+				}
+			}
+
+			// Interpolates between the last knot not above k and the next one,
+			// for k strictly inside the key range.
+			size_type	_predict(const Key& k) const {
+				size_type	p = _prefix(k);
+				const Point*	first = &_spline[0] + _radix[p];
+				const Point*	last = &_spline[0] + _radix[p + 1];
+				const Point*	knot = std::upper_bound(first, last, k) - 1;
+
+				if (knot->pos == _keys.size() - 1)
+					return knot->pos;
+
+				double	slope = static_cast<double>(knot[1].pos - knot->pos) / _delta(knot[1].key, knot->key);
+
+				return knot->pos + static_cast<size_type>(_delta(k, knot->key) * slope);
+			}
+
+			Key_vector		_keys;
+			Value_vector	_values;
+			Point_vector	_spline;
+			Radix_vector	_radix;
+			size_type		_max_error;
+			unsigned		_radix_bits;
+			unsigned		_shift;
+	};
+
+	template <typename Key, typename T, typename Alloc>
+	inline void	swap(learned_map<Key, T, Alloc>& x, learned_map<Key, T, Alloc>& y) { x.swap(y); }
+
+}//namespace
+
+#endif
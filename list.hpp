@@ -0,0 +1,503 @@
+#pragma once
+# ifndef LIST_HPP
+# define LIST_HPP
+
+# include <memory>
+# include "iterator.hpp"
+# include "algorithm.hpp"
+# include "functional.hpp"
+# include "List_iterator.hpp"
+
+# define _HEADER_LIST \
+	template <typename T, typename Alloc>
+
+namespace ft {
+
+	// Alloc is rebound to List_node<T>, pass ft::pool_allocator<T> to
+	// recycle nodes instead of going through operator new for each one.
+	template <typename T, typename Alloc = std::allocator<T> >
+	class	list {
+
+		public:
+			//rebind allocator for alloc nodes
+			typedef typename Alloc::template rebind<List_node<T> >::other	Node_allocator;
+
+			typedef T										value_type;
+			typedef typename Alloc::reference				reference;
+			typedef typename Alloc::const_reference			const_reference;
+			typedef typename Alloc::pointer					pointer;
+			typedef typename Alloc::const_pointer			const_pointer;
+			typedef List_iterator<T>						iterator;
+			typedef List_const_iterator<T>					const_iterator;
+			typedef ft::reverse_iterator<iterator>			reverse_iterator;
+			typedef ft::reverse_iterator<const_iterator>	const_reverse_iterator;
+			typedef ptrdiff_t								difference_type;
+			typedef size_t									size_type;
+			typedef Alloc									allocator_type;
+
+		private:
+			typedef List_node<T>	Node;
+
+			Node*	_create_node(const value_type& val) {
+				Node*	node = _node_alloc.allocate(1);
+
+				try {
+					_alloc.construct(&node->value, val);
+				}
+				catch (...) {
+					_node_alloc.deallocate(node, 1);
+					throw ;
+				}
+				return node;
+			}
+
+			void	_destroy_node(List_node_base* x) {
+				Node*	node = static_cast<Node*>(x);
+
+				_alloc.destroy(&node->value);
+				_node_alloc.deallocate(node, 1);
+			}
+
+			void	_init() {
+				_root.next = &_root;
+				_root.prev = &_root;
+				_node_count = 0;
+			}
+
+			void	_insert(List_node_base* pos, const value_type& val) {
+				list_hook(_create_node(val), pos);
+				++_node_count;
+			}
+
+			void	_erase(List_node_base* x) {
+				list_unhook(x);
+				_destroy_node(x);
+				--_node_count;
+			}
+
+			template <typename Integer>
+			void	_insert_dispatch(iterator position, Integer n, Integer val, true_type)
+			{ _fill_insert(position, static_cast<size_type>(n), static_cast<value_type>(val)); }
+
+			template <typename InputIterator>
+			void	_insert_dispatch(iterator position, InputIterator first, InputIterator last, false_type) {
+				for (; first != last; ++first)
+					_insert(position._node, *first);
+			}
+
+			void	_fill_insert(iterator position, size_type n, const value_type& val) {
+				for (; n > 0; --n)
+					_insert(position._node, val);
+			}
+
+			template <typename Integer>
+			void	_assign_dispatch(Integer n, Integer val, true_type)
+			{ assign(static_cast<size_type>(n), static_cast<value_type>(val)); }
+
+			template <typename InputIterator>
+			void	_assign_dispatch(InputIterator first, InputIterator last, false_type) {
+				iterator	cur = begin();
+
+				for (; first != last && cur != end(); ++cur, ++first)
+					*cur = *first;
+				if (first == last)
+					erase(cur, end());
+				else
+					insert(end(), first, last);
+			}
+
+			// Merges two null terminated chains linked through next only,
+			// a holds the earlier elements so ties keep the order of a.
+			template <typename Compare>
+			static List_node_base*	_merge_chains(List_node_base* a, List_node_base* b, Compare& comp) {
+				List_node_base	head;
+				List_node_base*	tail = &head;
+
+				while (a != 0 && b != 0) {
+					if (comp(static_cast<Node*>(b)->value, static_cast<Node*>(a)->value)) {
+						tail->next = b;
+						b = b->next;
+					}
+					else {
+						tail->next = a;
+						a = a->next;
+					}
+					tail = tail->next;
+				}
+				tail->next = (a != 0) ? a : b;
+				return head.next;
+			}
+
+		public:
+			//Constructors
+			explicit list(const allocator_type& alloc = allocator_type()) : _alloc(alloc), _node_alloc(alloc) { _init(); }
+
+			// A copy that throws frees the nodes already built: no destructor
+			// runs on a half-built list.
+			explicit list(size_type n, const value_type& val = value_type(), const allocator_type& alloc = allocator_type())
+			: _alloc(alloc), _node_alloc(alloc) {
+				_init();
+				try {
+					_fill_insert(end(), n, val);
+				}
+				catch (...) {
+					clear();
+					throw ;
+				}
+			}
+
+			template <typename InputIterator>
+			list(InputIterator first, InputIterator last, const allocator_type& alloc = allocator_type())
+			: _alloc(alloc), _node_alloc(alloc) {
+				typedef typename	ft::is_integral<InputIterator>::type	Integral;
+
+				_init();
+				try {
+					_insert_dispatch(end(), first, last, Integral());
+				}
+				catch (...) {
+					clear();
+					throw ;
+				}
+			}
+
+			list(const list& x) : _alloc(x._alloc), _node_alloc(x._node_alloc) {
+				_init();
+				try {
+					insert(end(), x.begin(), x.end());
+				}
+				catch (...) {
+					clear();
+					throw ;
+				}
+			}
+
+			//Destructor
+			~list() { clear(); }
+
+			//Assign operator
+			list&	operator=(const list& x) {
+				if (this != &x)
+					assign(x.begin(), x.end());
+				return *this;
+			}
+
+			template <typename InputIterator>
+			void	assign(InputIterator first, InputIterator last) {
+				typedef typename	ft::is_integral<InputIterator>::type	Integral;
+
+				_assign_dispatch(first, last, Integral());
+			}
+
+			void	assign(size_type n, const value_type& val) {
+				iterator	cur = begin();
+
+				for (; cur != end() && n > 0; ++cur, --n)
+					*cur = val;
+				if (n > 0)
+					_fill_insert(end(), n, val);
+				else
+					erase(cur, end());
+			}
+
+			allocator_type	get_allocator() const { return _alloc; }
+
+			//Iterators
+			iterator				begin() { return iterator(_root.next); }
+			const_iterator			begin() const { return const_iterator(_root.next); }
+			iterator				end() { return iterator(&_root); }
+			const_iterator			end() const { return const_iterator(&_root); }
+			reverse_iterator		rbegin() { return reverse_iterator(end()); }
+			const_reverse_iterator	rbegin() const { return const_reverse_iterator(end()); }
+			reverse_iterator		rend() { return reverse_iterator(begin()); }
+			const_reverse_iterator	rend() const { return const_reverse_iterator(begin()); }
+
+			//Capacity
+			bool		empty() const { return _root.next == &_root; }
+			size_type	size() const { return _node_count; }
+			size_type	max_size() const { return _node_alloc.max_size(); }
+
+			//Element access
+			reference		front() { return *begin(); }
+			const_reference	front() const { return *begin(); }
+			reference		back() { return *(--end()); }
+			const_reference	back() const { return *(--end()); }
+
+			//Modifiers
+			void	push_front(const value_type& val) { _insert(_root.next, val); }
+			void	pop_front() { _erase(_root.next); }
+			void	push_back(const value_type& val) { _insert(&_root, val); }
+			void	pop_back() { _erase(_root.prev); }
+
+			iterator	insert(iterator position, const value_type& val) {
+				_insert(position._node, val);
+				return iterator(position._node->prev);
+			}
+
+			void	insert(iterator position, size_type n, const value_type& val)
+			{ _fill_insert(position, n, val); }
+
+			template <typename InputIterator>
+			void	insert(iterator position, InputIterator first, InputIterator last) {
+				typedef typename	ft::is_integral<InputIterator>::type	Integral;
+
+				_insert_dispatch(position, first, last, Integral());
+			}
+
+			iterator	erase(iterator position) {
+				iterator	ret(position._node->next);
+
+				_erase(position._node);
+				return ret;
+			}
+
+			iterator	erase(iterator first, iterator last) {
+				while (first != last)
+					first = erase(first);
+				return last;
+			}
+
+			void	swap(list& x) {
+				list_swap(_root, x._root);
+				std::swap(_node_count, x._node_count);
+				std::swap(_alloc, x._alloc);
+				std::swap(_node_alloc, x._node_alloc);
+			}
+
+			void	resize(size_type n, value_type val = value_type()) {
+				if (n > _node_count)
+					_fill_insert(end(), n - _node_count, val);
+				else {
+					while (_node_count > n)
+						pop_back();
+				}
+			}
+
+			void	clear() {
+				List_node_base*	cur = _root.next;
+
+				while (cur != &_root) {
+					List_node_base*	next = cur->next;
+					_destroy_node(cur);
+					cur = next;
+				}
+				_init();
+			}
+
+			//Operations, none of them copies or reallocates a value, but
+			// splice() and merge() from a list whose node allocator compares
+			// unequal (another pool) copy its elements and clear it: nodes go
+			// back to the allocator they came from.
+			void	splice(iterator position, list& x) {
+				if (_node_alloc != x._node_alloc) {
+					list	tmp(x.begin(), x.end(), _alloc);
+
+					splice(position, tmp);
+					x.clear();
+				}
+				else if (!x.empty()) {
+					list_transfer(position._node, x.begin()._node, x.end()._node);
+					_node_count += x._node_count;
+					x._node_count = 0;
+				}
+			}
+
+			void	splice(iterator position, list& x, iterator i) {
+				iterator	j = i;
+
+				++j;
+				if (position == i || position == j)
+					return ;
+				if (_node_alloc != x._node_alloc) {
+					_insert(position._node, *i);
+					x._erase(i._node);
+					return ;
+				}
+				list_transfer(position._node, i._node, j._node);
+				++_node_count;
+				--x._node_count;
+			}
+
+			void	splice(iterator position, list& x, iterator first, iterator last) {
+				if (first == last)
+					return ;
+				if (_node_alloc != x._node_alloc) {
+					list	tmp(first, last, _alloc);
+
+					splice(position, tmp);
+					x.erase(first, last);
+					return ;
+				}
+				if (this != &x) {
+					const size_type	n = ft::distance(first, last);
+					_node_count += n;
+					x._node_count -= n;
+				}
+				list_transfer(position._node, first._node, last._node);
+			}
+
+			void	remove(const value_type& val) {
+				iterator	first = begin();
+				iterator	extra = end();
+
+				while (first != end()) {
+					iterator	next = first;
+					++next;
+					if (*first == val) {
+						// val may live in this very node, drop it last
+						if (&*first != &val)
+							_erase(first._node);
+						else
+							extra = first;
+					}
+					first = next;
+				}
+				if (extra != end())
+					_erase(extra._node);
+			}
+
+			template <typename Predicate>
+			void	remove_if(Predicate pred) {
+				iterator	first = begin();
+
+				while (first != end()) {
+					iterator	next = first;
+					++next;
+					if (pred(*first))
+						_erase(first._node);
+					first = next;
+				}
+			}
+
+			void	unique() { unique(ft::equal_to<value_type>()); }
+
+			template <typename BinaryPredicate>
+			void	unique(BinaryPredicate binary_pred) {
+				iterator	first = begin();
+
+				if (first == end())
+					return ;
+				iterator	next = first;
+				while (++next != end()) {
+					if (binary_pred(*first, *next))
+						_erase(next._node);
+					else
+						first = next;
+					next = first;
+				}
+			}
+
+			void	merge(list& x) { merge(x, ft::less<value_type>()); }
+
+			template <typename Compare>
+			void	merge(list& x, Compare comp) {
+				if (this == &x)
+					return ;
+				if (_node_alloc != x._node_alloc) {
+					list	tmp(x.begin(), x.end(), _alloc);
+
+					merge(tmp, comp);
+					x.clear();
+					return ;
+				}
+				iterator	first1 = begin();
+				iterator	first2 = x.begin();
+
+				while (first1 != end() && first2 != x.end()) {
+					if (comp(*first2, *first1)) {
+						iterator	next = first2;
+						list_transfer(first1._node, first2._node, (++next)._node);
+						first2 = next;
+					}
+					else
+						++first1;
+				}
+				if (first2 != x.end())
+					list_transfer(end()._node, first2._node, x.end()._node);
+				_node_count += x._node_count;
+				x._node_count = 0;
+			}
+
+			void	sort() { sort(ft::less<value_type>()); }
+
+			// Bottom-up merge sort on the node links: bins[i] holds a sorted
+			// run of 2^i nodes, merged like a binary counter. Stable, no
+			// allocation, O(n log n).
+			template <typename Compare>
+			void	sort(Compare comp) {
+				if (_node_count < 2)
+					return ;
+				List_node_base*	bins[sizeof(size_type) * 8];
+				size_type		fill = 0;
+				List_node_base*	cur = _root.next;
+
+				_root.prev->next = 0;
+				while (cur != 0) {
+					List_node_base*	carry = cur;
+					size_type		i = 0;
+
+					cur = cur->next;
+					carry->next = 0;
+					for (; i < fill && bins[i] != 0; ++i) {
+						carry = _merge_chains(bins[i], carry, comp);
+						bins[i] = 0;
+					}
+					bins[i] = carry;
+					if (i == fill)
+						++fill;
+				}
+				cur = 0;
+				for (size_type i = 0; i < fill; ++i) {
+					if (bins[i] != 0)
+						cur = (cur == 0) ? bins[i] : _merge_chains(bins[i], cur, comp);
+				}
+				// restore prev links and close the ring
+				List_node_base*	prev = &_root;
+				for (; cur != 0; prev = cur, cur = cur->next) {
+					prev->next = cur;
+					cur->prev = prev;
+				}
+				prev->next = &_root;
+				_root.prev = prev;
+			}
+
+			void	reverse() { list_reverse(&_root); }
+
+		private:
+			allocator_type	_alloc;
+			Node_allocator	_node_alloc;
+			size_type		_node_count;
+			List_node_base	_root;
+	};
+
+	_HEADER_LIST
+	inline bool	operator==(const list<T,Alloc>& x, const list<T,Alloc>& y)
+	{ return x.size() == y.size() && ft::equal(x.begin(), x.end(), y.begin()); }
+
+	_HEADER_LIST
+	inline bool	operator<(const list<T,Alloc>& x, const list<T,Alloc>& y)
+	{ return ft::lexicographical_compare(x.begin(), x.end(), y.begin(), y.end()); }
+
+	_HEADER_LIST
+	inline bool	operator!=(const list<T,Alloc>& x, const list<T,Alloc>& y)
+	{ return !(x == y); }
+
+	_HEADER_LIST
+	inline bool	operator<=(const list<T,Alloc>& x, const list<T,Alloc>& y)
+	{ return !(y < x); }
+
+	_HEADER_LIST
+	inline bool	operator>(const list<T,Alloc>& x, const list<T,Alloc>& y)
+	{ return y < x; }
+
+	_HEADER_LIST
+	inline bool	operator>=(const list<T,Alloc>& x, const list<T,Alloc>& y)
+	{ return !(x < y); }
+
+	_HEADER_LIST
+	inline void	swap(list<T,Alloc>& x, list<T,Alloc>& y)
+	{ x.swap(y); }
+
+}//namespace
+
+#endif
@@ -4,13 +4,18 @@
 
 # include "tree.hpp"
 # include "functional.hpp"
+# if __cplusplus >= 201103L
+#  include <utility>
+# endif
 
 namespace ft {
 
 # define _HEADER_HELP_DFT \
-		template <typename Key, typename T, typename Compare, typename Alloc>
+		template <typename Key, typename T, typename Compare, typename Alloc, typename Cache, typename Balance>
 
-	template <class Key, class T, class Compare = ft::less<Key>, class Alloc = std::allocator<pair<const Key, T> > >
+	// Cache is the lookup policy of the tree, see Rb_cache.hpp, Balance
+	// its balancing policy, Rb_balance or Splay_balance.
+	template <class Key, class T, class Compare = ft::less<Key>, class Alloc = std::allocator<pair<const Key, T> >, class Cache = Rb_no_cache, class Balance = Rb_balance>
 	class	map {
 
 		public:
@@ -32,7 +37,7 @@ namespace ft {
 			};
 
 		private:
-			typedef Rb_tree<key_type, value_type, select1st<value_type>, key_compare, allocator_type>	Tree;
+			typedef Rb_tree<key_type, value_type, select1st<value_type>, key_compare, allocator_type, Cache, Balance>	Tree;
 
 			Tree	_t;
 
@@ -77,13 +82,7 @@ namespace ft {
 			size_type	max_size() const { return _t.max_size(); }
 
 			//element access
-			mapped_type&	operator[](const key_type k) {
-				iterator	i = lower_bound(k);
-
-				if (i == end() || key_comp()(k, (*i).first))
-					i = insert(i, value_type(k, mapped_type()));
-				return (*i).second;
-			}
+			mapped_type&	operator[](const key_type& k) { return find_or_insert(k).first->second; }
 
 			//modifiers
 			pair<iterator, bool>	insert(const value_type& val) { return _t.insert(val); }
@@ -91,6 +90,48 @@ namespace ft {
 			template <class InputIterator>
 			void					insert(InputIterator first, InputIterator last) { _t.insert(first, last); }
 
+			// The following descend the tree once and build the value only
+			// when k is absent. The bool tells whether it was inserted.
+			pair<iterator, bool>	find_or_insert(const key_type& k) { return try_emplace(k); }
+
+			pair<iterator, bool>	insert_or_assign(const key_type& k, const mapped_type& obj) {
+				typename Tree::Insert_pos	pos = _t.locate(k);
+
+				if (pos.found) {
+					pos.node->value.second = obj;
+					return pair<iterator, bool>(iterator(pos.node), false);
+				}
+				return pair<iterator, bool>(_t.emplace_at(pos, k, obj), true);
+			}
+
+			pair<iterator, bool>	try_emplace(const key_type& k) {
+				typename Tree::Insert_pos	pos = _t.locate(k);
+
+				if (pos.found)
+					return pair<iterator, bool>(iterator(pos.node), false);
+				return pair<iterator, bool>(_t.emplace_at(pos, k, emplace_second_t()), true);
+			}
+
+# if __cplusplus >= 201103L
+			template <typename... Args>
+			pair<iterator, bool>	try_emplace(const key_type& k, Args&&... args) {
+				typename Tree::Insert_pos	pos = _t.locate(k);
+
+				if (pos.found)
+					return pair<iterator, bool>(iterator(pos.node), false);
+				return pair<iterator, bool>(_t.emplace_at(pos, k, emplace_second_t(), std::forward<Args>(args)...), true);
+			}
+# else
+			template <typename A>
+			pair<iterator, bool>	try_emplace(const key_type& k, const A& a) {
+				typename Tree::Insert_pos	pos = _t.locate(k);
+
+				if (pos.found)
+					return pair<iterator, bool>(iterator(pos.node), false);
+				return pair<iterator, bool>(_t.emplace_at(pos, k, emplace_second_t(), a), true);
+			}
+# endif
+
 			void		erase(iterator position) { _t.erase(position); }
 			size_type	erase(const key_type& k) { return _t.erase(k); }
 			void		erase(iterator first, iterator last) { _t.erase(first, last); }
@@ -100,6 +141,7 @@ namespace ft {
 			//observers
 			key_compare		key_comp() const { return _t.key_comp(); }
 			value_compare	value_comp() const { return value_compare(_t.key_comp()); }
+			const Cache&	lookup_cache() const { return _t.lookup_cache(); }
 
 			//operations
 			iterator		find(const key_type& k) { return _t.find(k); }
@@ -110,42 +152,70 @@ namespace ft {
 			iterator		upper_bound(const key_type& k) { return _t.upper_bound(k); }
 			const_iterator	upper_bound(const key_type& k) const { return _t.upper_bound(k); }
 
+			// Lookups starting from hint, cheap when k is close to it.
+			iterator		find(const_iterator hint, const key_type& k) { return _t.find(hint, k); }
+			const_iterator	find(const_iterator hint, const key_type& k) const { return _t.find(hint, k); }
+			iterator		lower_bound(const_iterator hint, const key_type& k) { return _t.lower_bound(hint, k); }
+			const_iterator	lower_bound(const_iterator hint, const key_type& k) const { return _t.lower_bound(hint, k); }
+
 			pair<iterator, iterator>				equal_range(const key_type& k) { return _t.equal_range(k); }
 			pair<const_iterator, const_iterator>	equal_range(const key_type& k) const { return _t.equal_range(k); }
 
-			template <typename K1, typename T1, typename C1, typename A1>
-			friend bool	operator==(const map<K1, T1, C1, A1>&, const map<K1, T1, C1, A1>&);
-
-			template <typename K1, typename T1, typename C1, typename A1>
-			friend bool	operator<(const map<K1, T1, C1, A1>&, const map<K1, T1, C1, A1>&);
+			//batched lookups
+			// One iterator, or one bool, per key of [first, last), see
+			// Rb_tree::find_many.
+			template <typename ForwardIterator, typename OutputIterator>
+			OutputIterator	find_many(ForwardIterator first, ForwardIterator last, OutputIterator out) { return _t.find_many(first, last, out); }
+			template <typename ForwardIterator, typename OutputIterator>
+			OutputIterator	find_many(ForwardIterator first, ForwardIterator last, OutputIterator out) const { return _t.find_many(first, last, out); }
+			template <typename ForwardIterator, typename OutputIterator>
+			OutputIterator	contains_many(ForwardIterator first, ForwardIterator last, OutputIterator out) const { return _t.contains_many(first, last, out); }
+
+			//scans
+			// fn(value_type&) is called in key order until it returns false,
+			// see Rb_tree::for_each.
+			template <typename Fn>
+			bool	for_each(Fn fn) { return _t.for_each(fn); }
+			template <typename Fn>
+			bool	for_each(Fn fn) const { return _t.for_each(fn); }
+			template <typename Fn>
+			bool	for_each_in_range(const key_type& lo, const key_type& hi, Fn fn) { return _t.for_each_in_range(lo, hi, fn); }
+			template <typename Fn>
+			bool	for_each_in_range(const key_type& lo, const key_type& hi, Fn fn) const { return _t.for_each_in_range(lo, hi, fn); }
+
+			template <typename K1, typename T1, typename C1, typename A1, typename H1, typename B1>
+			friend bool	operator==(const map<K1, T1, C1, A1, H1, B1>&, const map<K1, T1, C1, A1, H1, B1>&);
+
+			template <typename K1, typename T1, typename C1, typename A1, typename H1, typename B1>
+			friend bool	operator<(const map<K1, T1, C1, A1, H1, B1>&, const map<K1, T1, C1, A1, H1, B1>&);
 	};
 
 	_HEADER_HELP_DFT 
-	inline bool	operator==(const map<Key, T, Compare, Alloc>& x, const map<Key, T, Compare, Alloc>& y)
+	inline bool	operator==(const map<Key, T, Compare, Alloc, Cache, Balance>& x, const map<Key, T, Compare, Alloc, Cache, Balance>& y)
 	{ return x._t == y._t; }
 
 	_HEADER_HELP_DFT
-	inline bool	operator<(const map<Key, T, Compare, Alloc>& x, const map<Key, T, Compare, Alloc>& y)
+	inline bool	operator<(const map<Key, T, Compare, Alloc, Cache, Balance>& x, const map<Key, T, Compare, Alloc, Cache, Balance>& y)
 	{ return x._t < y._t; }
 
 	_HEADER_HELP_DFT
-	inline bool	operator!=(const map<Key, T, Compare, Alloc>& x, const map<Key, T, Compare, Alloc>& y)
+	inline bool	operator!=(const map<Key, T, Compare, Alloc, Cache, Balance>& x, const map<Key, T, Compare, Alloc, Cache, Balance>& y)
 	{ return !(x == y); }
 
 	_HEADER_HELP_DFT
-	inline bool	operator>(const map<Key, T, Compare, Alloc>& x, const map<Key, T, Compare, Alloc>& y)
+	inline bool	operator>(const map<Key, T, Compare, Alloc, Cache, Balance>& x, const map<Key, T, Compare, Alloc, Cache, Balance>& y)
 	{ return y < x; }
 
 	_HEADER_HELP_DFT
-	inline bool	operator>=(const map<Key, T, Compare, Alloc>& x, const map<Key, T, Compare, Alloc>& y)
+	inline bool	operator>=(const map<Key, T, Compare, Alloc, Cache, Balance>& x, const map<Key, T, Compare, Alloc, Cache, Balance>& y)
 	{ return !(x < y); }
 
 	_HEADER_HELP_DFT
-	inline bool	operator<=(const map<Key, T, Compare, Alloc>& x, const map<Key, T, Compare, Alloc>& y)
+	inline bool	operator<=(const map<Key, T, Compare, Alloc, Cache, Balance>& x, const map<Key, T, Compare, Alloc, Cache, Balance>& y)
 	{ return !(y < x); }
 
 	_HEADER_HELP_DFT
-	void	swap(map<Key, T, Compare, Alloc>& x, map<Key, T, Compare, Alloc>& y)
+	void	swap(map<Key, T, Compare, Alloc, Cache, Balance>& x, map<Key, T, Compare, Alloc, Cache, Balance>& y)
 	{ x.swap(y); }
 
 }//namespace
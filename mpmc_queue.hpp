@@ -0,0 +1,198 @@
+#pragma once
+# ifndef MPMC_QUEUE_HPP
+# define MPMC_QUEUE_HPP
+
+# include <memory>
+# include <new>
+# include <utility>
+# include <stdexcept>
+# include <type_traits>
+# include "concurrent_base.hpp"
+
+namespace ft {
+
+	// Bounded multi producer / multi consumer ring (D. Vyukov). Each cell
+	// carries a sequence number: seq == pos means free for the producer
+	// of pos, seq == pos + 1 means filled for the consumer of pos. Threads
+	// only contend on the CAS of _enqueue_pos or _dequeue_pos.
+	template <typename T, typename Alloc = std::allocator<T> >
+	class	mpmc_queue {
+
+		public:
+			typedef T			value_type;
+			typedef size_t		size_type;
+			typedef Alloc		allocator_type;
+
+		private:
+			struct	Cell {
+				std::atomic<size_type>	seq;
+				typename std::aligned_storage<sizeof(T), alignof(T)>::type	storage;
+
+				T*	value() { return reinterpret_cast<T*>(&storage); }
+			};
+
+			typedef typename std::allocator_traits<Alloc>::template rebind_alloc<Cell>	Cell_allocator;
+			typedef std::allocator_traits<Cell_allocator>								Cell_traits;
+
+			// Past half the range there is no power of two left to round to.
+			static size_type	_round_up(size_type n) {
+				size_type	cap = 2;
+
+				if (n > size_type(-1) / 2 + 1)
+					throw std::length_error("mpmc_queue::mpmc_queue");
+
+				while (cap < n)
+					cap <<= 1;
+				return cap;
+			}
+
+		public:
+			explicit mpmc_queue(size_type capacity, const allocator_type& alloc = allocator_type())
+			: _cell_alloc(alloc), _mask(_round_up(capacity) - 1) {
+				if (_mask + 1 > Cell_traits::max_size(_cell_alloc))
+					throw std::length_error("mpmc_queue::mpmc_queue");
+				_cells = Cell_traits::allocate(_cell_alloc, _mask + 1);
+				for (size_type i = 0; i <= _mask; ++i)
+					::new(static_cast<void*>(&_cells[i].seq)) std::atomic<size_type>(i);
+			}
+
+			mpmc_queue(const mpmc_queue&) = delete;
+			mpmc_queue&	operator=(const mpmc_queue&) = delete;
+
+			~mpmc_queue() {
+				size_type		pos = _dequeue_pos.value.load(std::memory_order_relaxed);
+				const size_type	end = _enqueue_pos.value.load(std::memory_order_relaxed);
+
+				for (; pos != end; ++pos) {
+					Cell&	cell = _cells[pos & _mask];
+					if (cell.seq.load(std::memory_order_relaxed) == pos + 1)
+						cell.value()->~T();
+				}
+				Cell_traits::deallocate(_cell_alloc, _cells, _mask + 1);
+			}
+
+			size_type	capacity() const { return _mask + 1; }
+
+			// Only exact when no operation is in flight.
+			size_type	size_approx() const {
+				const size_type	head = _dequeue_pos.value.load(std::memory_order_acquire);
+				const size_type	tail = _enqueue_pos.value.load(std::memory_order_acquire);
+				return tail > head ? tail - head : 0;
+			}
+
+			bool	try_push(const value_type& val) { return _try_emplace(val); }
+			bool	try_push(value_type&& val) { return _try_emplace(std::move(val)); }
+
+			bool	try_pop(value_type& out) {
+				size_type	pos = _dequeue_pos.value.load(std::memory_order_relaxed);
+				Cell*		cell;
+
+				for (;;) {
+					cell = &_cells[pos & _mask];
+					const size_type	seq = cell->seq.load(std::memory_order_acquire);
+					const ptrdiff_t	dif = ptrdiff_t(seq) - ptrdiff_t(pos + 1);
+
+					if (dif == 0) {
+						if (_dequeue_pos.value.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+							break ;
+					}
+					else if (dif < 0)
+						return false;
+					else
+						pos = _dequeue_pos.value.load(std::memory_order_relaxed);
+				}
+				_release(*cell, pos, out);
+				_not_full.value.notify();
+				return true;
+			}
+
+			// Claims up to n consecutive filled cells with a single CAS and
+			// returns how many were popped into out.
+			template <typename OutputIterator>
+			size_type	try_pop_n(OutputIterator out, size_type n) {
+				size_type	pos = _dequeue_pos.value.load(std::memory_order_relaxed);
+				size_type	k;
+
+				if (n == 0)
+					return 0;
+				for (;;) {
+					for (k = 0; k < n; ++k) {
+						const size_type	seq = _cells[(pos + k) & _mask].seq.load(std::memory_order_acquire);
+						if (seq != pos + k + 1)
+							break ;
+					}
+					if (k == 0) {
+						const size_type	seq = _cells[pos & _mask].seq.load(std::memory_order_acquire);
+						if (ptrdiff_t(seq) - ptrdiff_t(pos + 1) < 0)
+							return 0;
+						pos = _dequeue_pos.value.load(std::memory_order_relaxed);
+					}
+					else if (_dequeue_pos.value.compare_exchange_weak(pos, pos + k, std::memory_order_relaxed))
+						break ;
+				}
+				for (size_type i = 0; i < k; ++i, ++out)
+					_release(_cells[(pos + i) & _mask], pos + i, *out);
+				_not_full.value.notify();
+				return k;
+			}
+
+			// Blocking variants: spin on the try_ version, then sleep on a futex
+			// until the other side makes progress.
+			void	push(const value_type& val) {
+				_not_full.value.wait_until([&]() { return _try_emplace(val); });
+			}
+
+			void	pop(value_type& out) {
+				_not_empty.value.wait_until([&]() { return try_pop(out); });
+			}
+
+		private:
+			template <typename U>
+			bool	_try_emplace(U&& val) {
+				size_type	pos = _enqueue_pos.value.load(std::memory_order_relaxed);
+				Cell*		cell;
+
+				for (;;) {
+					cell = &_cells[pos & _mask];
+					const size_type	seq = cell->seq.load(std::memory_order_acquire);
+					const ptrdiff_t	dif = ptrdiff_t(seq) - ptrdiff_t(pos);
+
+					if (dif == 0) {
+						if (_enqueue_pos.value.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+							break ;
+					}
+					else if (dif < 0)
+						return false;
+					else
+						pos = _enqueue_pos.value.load(std::memory_order_relaxed);
+				}
+				::new(static_cast<void*>(cell->value())) T(std::forward<U>(val));
+				cell->seq.store(pos + 1, std::memory_order_release);
+				_not_empty.value.notify();
+				return true;
+			}
+
+			// Moves the value out and hands the cell to the producer of the
+			// next lap. out is a value_type& or what *it gives for an output
+			// iterator, an insert iterator for one.
+			template <typename Out>
+			void	_release(Cell& cell, size_type pos, Out&& out) {
+				T*	val = cell.value();
+
+				out = std::move(*val);
+				val->~T();
+				cell.seq.store(pos + _mask + 1, std::memory_order_release);
+			}
+
+			Cell_allocator							_cell_alloc;
+			Cell*									_cells;
+			size_type								_mask;
+			cache_padded<std::atomic<size_type> >	_enqueue_pos;
+			cache_padded<std::atomic<size_type> >	_dequeue_pos;
+			cache_padded<Event_count>				_not_empty;
+			cache_padded<Event_count>				_not_full;
+	};
+
+}//namespace
+
+#endif
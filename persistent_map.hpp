@@ -0,0 +1,572 @@
+#pragma once
+# ifndef PERSISTENT_MAP_HPP
+# define PERSISTENT_MAP_HPP
+
+# include <algorithm>
+# include <memory>
+# include <stdexcept>
+# include "Rb_base.hpp"
+# include "algorithm.hpp"
+# include "functional.hpp"
+# include "iterator_base.hpp"
+# include "refcount.hpp"
+# include "utility.hpp"
+
+namespace ft {
+
+	// Nodes are shared between versions and never written once shared,
+	// so they carry no parent pointer.
+	template <typename Val>
+	struct	Pmap_node {
+		refcount_type	refs;
+		Color			color;
+		Pmap_node*		left;
+		Pmap_node*		right;
+		Val				value;
+	};
+
+	// In-order walk over an immutable tree: the stack holds the nodes
+	// still to visit, the current one on top.
+	template <typename Val>
+	struct	Pmap_iterator {
+		typedef Val						value_type;
+		typedef const Val&				reference;
+		typedef const Val*				pointer;
+		typedef ptrdiff_t				difference_type;
+		typedef forward_iterator_tag	iterator_category;
+		typedef Pmap_iterator<Val>		Self;
+		typedef const Pmap_node<Val>*	Node_ptr;
+
+		// a red-black tree is at most twice as high as a perfect one
+		enum { max_height = 2 * sizeof(size_t) * 8 };
+
+		Pmap_iterator() : _top(0) {}
+
+		Pmap_iterator(const Self& x) : _top(x._top) {
+			for (unsigned i = 0; i < _top; ++i)
+				_stack[i] = x._stack[i];
+		}
+
+		Self&	operator=(const Self& x) {
+			_top = x._top;
+			for (unsigned i = 0; i < _top; ++i)
+				_stack[i] = x._stack[i];
+			return *this;
+		}
+
+		reference	operator*() const { return _stack[_top - 1]->value; }
+		pointer		operator->() const { return &_stack[_top - 1]->value; }
+
+		Self&	operator++() {
+			Node_ptr	x = _stack[--_top];
+
+			_push_left(x->right);
+			return *this;
+		}
+
+		Self	operator++(int) {
+			Self	tmp = *this;
+			this->operator++();
+			return tmp;
+		}
+
+		friend bool	operator==(const Self& x, const Self& y) {
+			if (x._top == 0 || y._top == 0)
+				return x._top == y._top;
+			return x._stack[x._top - 1] == y._stack[y._top - 1];
+		}
+
+		friend bool	operator!=(const Self& x, const Self& y) { return !(x == y); }
+
+		void	_push(Node_ptr x) { _stack[_top++] = x; }
+		void	_push_left(Node_ptr x) {
+			for (; x != 0; x = x->left)
+				_stack[_top++] = x;
+		}
+
+		Node_ptr	_stack[max_height];
+		unsigned	_top;
+	};
+
+# define _HEADER_PMAP \
+		template <typename Key, typename T, typename Compare, typename Alloc>
+
+	// Immutable red-black map. insert, assign and erase leave the map
+	// untouched and return a new version that shares every node off the
+	// updated path, so a snapshot is a copy in O(1) and an update
+	// allocates O(log n) nodes. Insertion is Okasaki's, erasure Kahrs'.
+	// Node counts are atomic: versions may be handed to other threads.
+	template <class Key, class T, class Compare = ft::less<Key>, class Alloc = std::allocator<pair<const Key, T> > >
+	class	persistent_map {
+
+		public:
+			typedef Key								key_type;
+			typedef T								mapped_type;
+			typedef pair<const Key, T>				value_type;
+			typedef Compare							key_compare;
+			typedef Alloc							allocator_type;
+			typedef size_t							size_type;
+			typedef ptrdiff_t						difference_type;
+			typedef const value_type&				const_reference;
+			typedef Pmap_iterator<value_type>		const_iterator;
+			typedef const_iterator					iterator;
+
+		private:
+			typedef Pmap_node<value_type>									Node;
+			typedef Node*													Node_ptr;
+			typedef typename Alloc::template rebind<Node>::other			Node_allocator;
+
+		public:
+			explicit persistent_map(const Compare& comp = key_compare(), const allocator_type& alloc = allocator_type())
+			: _alloc(alloc), _key_compare(comp), _root(0), _size(0) {}
+
+			template <class InputIterator>
+			persistent_map(InputIterator first, InputIterator last, const Compare& comp = key_compare(), const allocator_type& alloc = allocator_type())
+			: _alloc(alloc), _key_compare(comp), _root(0), _size(0) {
+				// the map hands its own reference over: nodes it alone holds
+				// are rewritten in place
+				for (; first != last; ++first)
+					if (!_contains((*first).first)) {
+						_root = _blacken(_ins(_root, *first));
+						++_size;
+					}
+			}
+
+			// O(1): the copy shares the whole tree.
+			persistent_map(const persistent_map& x)
+			: _alloc(x._alloc), _key_compare(x._key_compare), _root(_share(x._root)), _size(x._size) {}
+
+			~persistent_map() { _release(_root); }
+
+			persistent_map&	operator=(const persistent_map& x) {
+				Node_ptr	old = _root;
+
+				_root = _share(x._root);
+				_release(old);
+				_key_compare = x._key_compare;
+				_size = x._size;
+				return *this;
+			}
+
+			allocator_type	get_allocator() const { return _alloc; }
+
+			//iterators
+			const_iterator	begin() const {
+				const_iterator	it;
+
+				it._push_left(_root);
+				return it;
+			}
+
+			const_iterator	end() const { return const_iterator(); }
+
+			//capacity
+			bool		empty() const { return _size == 0; }
+			size_type	size() const { return _size; }
+			size_type	max_size() const { return Node_allocator(_alloc).max_size(); }
+
+			//element access
+			const mapped_type&	at(const key_type& k) const {
+				const_iterator	it = find(k);
+
+				if (it == end())
+					throw std::out_of_range("persistent_map::at");
+				return it->second;
+			}
+
+			//versions
+			// Returns a version with val inserted, or *this if its key exists.
+			persistent_map	insert(const value_type& val) const {
+				if (_contains(val.first))
+					return *this;
+				return persistent_map(*this, _blacken(_ins(_share(_root), val)), _size + 1);
+			}
+
+			// Returns a version where k maps to obj, inserted or overwritten.
+			persistent_map	assign(const key_type& k, const mapped_type& obj) const {
+				if (_contains(k))
+					return persistent_map(*this, _set(_share(_root), k, obj), _size);
+				return persistent_map(*this, _blacken(_ins(_share(_root), value_type(k, obj))), _size + 1);
+			}
+
+			// Returns a version without k, or *this if k is absent.
+			persistent_map	erase(const key_type& k) const {
+				if (!_contains(k))
+					return *this;
+				return persistent_map(*this, _blacken(_del(_share(_root), k)), _size - 1);
+			}
+
+			void	swap(persistent_map& x) {
+				std::swap(_root, x._root);
+				std::swap(_size, x._size);
+				std::swap(_key_compare, x._key_compare);
+				std::swap(_alloc, x._alloc);
+			}
+
+			//observers
+			key_compare	key_comp() const { return _key_compare; }
+
+			//operations
+			const_iterator	find(const key_type& k) const {
+				const_iterator	it = lower_bound(k);
+
+				if (it != end() && _key_compare(k, it->first))
+					return end();
+				return it;
+			}
+
+			size_type	count(const key_type& k) const { return _contains(k) ? 1 : 0; }
+
+			const_iterator	lower_bound(const key_type& k) const {
+				const_iterator	it;
+
+				for (Node_ptr x = _root; x != 0; ) {
+					if (!_key_compare(x->value.first, k)) {
+						it._push(x);
+						x = x->left;
+					}
+					else
+						x = x->right;
+				}
+				return it;
+			}
+
+			const_iterator	upper_bound(const key_type& k) const {
+				const_iterator	it;
+
+				for (Node_ptr x = _root; x != 0; ) {
+					if (_key_compare(k, x->value.first)) {
+						it._push(x);
+						x = x->left;
+					}
+					else
+						x = x->right;
+				}
+				return it;
+			}
+
+			pair<const_iterator, const_iterator>	equal_range(const key_type& k) const
+			{ return ft::make_pair(lower_bound(k), upper_bound(k)); }
+
+		private:
+			// New version of x owning root.
+			persistent_map(const persistent_map& x, Node_ptr root, size_type n)
+			: _alloc(x._alloc), _key_compare(x._key_compare), _root(root), _size(n) {}
+
+			bool	_contains(const key_type& k) const {
+				Node_ptr	x = _root;
+
+				while (x != 0) {
+					if (_key_compare(k, x->value.first))
+						x = x->left;
+					else if (_key_compare(x->value.first, k))
+						x = x->right;
+					else
+						return true;
+				}
+				return false;
+			}
+
+			//nodes
+			// Every function below consumes the references it is given and
+			// returns an owned one. A node only this update holds is rewritten
+			// in place, a shared one is copied.
+			static Node_ptr	_share(Node_ptr x) {
+				if (x != 0)
+					refcount_acquire(x->refs);
+				return x;
+			}
+
+			void	_release(Node_ptr x) const {
+				if (x != 0 && refcount_release(x->refs)) {
+					_release(x->left);
+					_release(x->right);
+					_destroy_node(x);
+				}
+			}
+
+			Node_ptr	_create_node(Color c, Node_ptr l, const value_type& val, Node_ptr r) const {
+				Node_ptr	node = Node_allocator(_alloc).allocate(1);
+
+				try {
+					Alloc(_alloc).construct(&node->value, val);
+				}
+				catch (...) {
+					Node_allocator(_alloc).deallocate(node, 1);
+					_release(l);
+					_release(r);
+					throw ;
+				}
+				node->refs = 1;
+				node->color = c;
+				node->left = l;
+				node->right = r;
+				return node;
+			}
+
+			void	_destroy_node(Node_ptr node) const {
+				Alloc(_alloc).destroy(&node->value);
+				Node_allocator(_alloc).deallocate(node, 1);
+			}
+
+			// Node (l, value of src, r) colored c.
+			Node_ptr	_node(Color c, Node_ptr l, Node_ptr src, Node_ptr r) const {
+				if (refcount_unique(src->refs)) {
+					Node_ptr	old_l = src->left;
+					Node_ptr	old_r = src->right;
+
+					src->color = c;
+					src->left = l;
+					src->right = r;
+					_release(old_l);
+					_release(old_r);
+					return src;
+				}
+				Node_ptr	node = _create_node(c, l, src->value, r);
+				_release(src);
+				return node;
+			}
+
+			// Shares the children of x, which stays owned by the caller.
+			static void	_open(Node_ptr x, Node_ptr& l, Node_ptr& r) {
+				l = _share(x->left);
+				r = _share(x->right);
+			}
+
+			Node_ptr	_paint(Node_ptr x, Color c) const {
+				Node_ptr	l;
+				Node_ptr	r;
+
+				if (x->color == c)
+					return x;
+				_open(x, l, r);
+				return _node(c, l, x, r);
+			}
+
+			Node_ptr	_blacken(Node_ptr x) const { return x == 0 ? x : _paint(x, _black); }
+
+			static bool	_is_red(Node_ptr x) { return x != 0 && x->color == _red; }
+			static bool	_is_black(Node_ptr x) { return x != 0 && x->color == _black; }
+
+			//rebalancing
+			// Black node (l, src, r) where one side may hold a red-red pair.
+			Node_ptr	_balance(Node_ptr l, Node_ptr src, Node_ptr r) const {
+				Node_ptr	a;
+				Node_ptr	b;
+				Node_ptr	c;
+				Node_ptr	y;
+
+				if (_is_red(l) && _is_red(r)) {
+					l = _paint(l, _black);
+					r = _paint(r, _black);
+					return _node(_red, l, src, r);
+				}
+				if (_is_red(l) && _is_red(l->left)) {
+					_open(l, y, c);
+					y = _paint(y, _black);
+					r = _node(_black, c, src, r);
+					return _node(_red, y, l, r);
+				}
+				if (_is_red(l) && _is_red(l->right)) {
+					_open(l, a, y);
+					_open(y, b, c);
+					l = _node(_black, a, l, b);
+					r = _node(_black, c, src, r);
+					return _node(_red, l, y, r);
+				}
+				if (_is_red(r) && _is_red(r->right)) {
+					_open(r, b, y);
+					l = _node(_black, l, src, b);
+					y = _paint(y, _black);
+					return _node(_red, l, r, y);
+				}
+				if (_is_red(r) && _is_red(r->left)) {
+					_open(r, y, c);
+					_open(y, a, b);
+					l = _node(_black, l, src, a);
+					r = _node(_black, b, r, c);
+					return _node(_red, l, y, r);
+				}
+				return _node(_black, l, src, r);
+			}
+
+			// The left side of (l, src, r) lost one black level.
+			Node_ptr	_balance_left(Node_ptr l, Node_ptr src, Node_ptr r) const {
+				Node_ptr	a;
+				Node_ptr	b;
+				Node_ptr	c;
+				Node_ptr	y;
+
+				if (_is_red(l)) {
+					l = _paint(l, _black);
+					return _node(_red, l, src, r);
+				}
+				if (_is_black(r)) {
+					r = _paint(r, _red);
+					return _balance(l, src, r);
+				}
+				_open(r, y, c);
+				_open(y, a, b);
+				l = _node(_black, l, src, a);
+				c = _balance(b, r, _paint(c, _red));
+				return _node(_red, l, y, c);
+			}
+
+			// The right side of (l, src, r) lost one black level.
+			Node_ptr	_balance_right(Node_ptr l, Node_ptr src, Node_ptr r) const {
+				Node_ptr	a;
+				Node_ptr	b;
+				Node_ptr	c;
+				Node_ptr	y;
+
+				if (_is_red(r)) {
+					r = _paint(r, _black);
+					return _node(_red, l, src, r);
+				}
+				if (_is_black(l)) {
+					l = _paint(l, _red);
+					return _balance(l, src, r);
+				}
+				_open(l, a, y);
+				_open(y, b, c);
+				a = _balance(_paint(a, _red), l, b);
+				r = _node(_black, c, src, r);
+				return _node(_red, a, y, r);
+			}
+
+			//updates
+			Node_ptr	_ins(Node_ptr x, const value_type& val) const {
+				Node_ptr	l;
+				Node_ptr	r;
+
+				if (x == 0)
+					return _create_node(_red, 0, val, 0);
+				_open(x, l, r);
+				if (_key_compare(val.first, x->value.first)) {
+					l = _ins(l, val);
+					return x->color == _black ? _balance(l, x, r) : _node(_red, l, x, r);
+				}
+				r = _ins(r, val);
+				return x->color == _black ? _balance(l, x, r) : _node(_red, l, x, r);
+			}
+
+			// Copies the path to k, whose node gets obj.
+			Node_ptr	_set(Node_ptr x, const key_type& k, const mapped_type& obj) const {
+				Node_ptr	l;
+				Node_ptr	r;
+
+				_open(x, l, r);
+				if (_key_compare(k, x->value.first))
+					l = _set(l, k, obj);
+				else if (_key_compare(x->value.first, k))
+					r = _set(r, k, obj);
+				else if (refcount_unique(x->refs))
+					x->value.second = obj;
+				else {
+					Node_ptr	node = _create_node(x->color, l, value_type(x->value.first, obj), r);
+					_release(x);
+					return node;
+				}
+				return _node(x->color, l, x, r);
+			}
+
+			Node_ptr	_del(Node_ptr x, const key_type& k) const {
+				Node_ptr	l;
+				Node_ptr	r;
+
+				_open(x, l, r);
+				if (_key_compare(k, x->value.first)) {
+					const bool	was_black = _is_black(l);
+
+					l = _del(l, k);
+					return was_black ? _balance_left(l, x, r) : _node(_red, l, x, r);
+				}
+				if (_key_compare(x->value.first, k)) {
+					const bool	was_black = _is_black(r);
+
+					r = _del(r, k);
+					return was_black ? _balance_right(l, x, r) : _node(_red, l, x, r);
+				}
+				_release(x);
+				return _fuse(l, r);
+			}
+
+			// Joins the two subtrees of an erased node, every key of l being
+			// less than every key of r.
+			Node_ptr	_fuse(Node_ptr l, Node_ptr r) const {
+				Node_ptr	a;
+				Node_ptr	b;
+				Node_ptr	c;
+				Node_ptr	d;
+				Node_ptr	m;
+
+				if (l == 0)
+					return r;
+				if (r == 0)
+					return l;
+				if (l->color == r->color) {
+					const Color	col = l->color;
+
+					_open(l, a, b);
+					_open(r, c, d);
+					m = _fuse(b, c);
+					if (_is_red(m)) {
+						_open(m, b, c);
+						l = _node(col, a, l, b);
+						r = _node(col, c, r, d);
+						return _node(_red, l, m, r);
+					}
+					if (col == _red) {
+						r = _node(_red, m, r, d);
+						return _node(_red, a, l, r);
+					}
+					r = _node(_black, m, r, d);
+					return _balance_left(a, l, r);
+				}
+				if (_is_red(r)) {
+					_open(r, c, d);
+					c = _fuse(l, c);
+					return _node(_red, c, r, d);
+				}
+				_open(l, a, b);
+				b = _fuse(b, r);
+				return _node(_red, a, l, b);
+			}
+
+			allocator_type	_alloc;
+			key_compare		_key_compare;
+			Node_ptr		_root;
+			size_type		_size;
+	};
+
+	_HEADER_PMAP
+	inline bool	operator==(const persistent_map<Key, T, Compare, Alloc>& x, const persistent_map<Key, T, Compare, Alloc>& y)
+	{ return x.size() == y.size() && ft::equal(x.begin(), x.end(), y.begin()); }
+
+	_HEADER_PMAP
+	inline bool	operator<(const persistent_map<Key, T, Compare, Alloc>& x, const persistent_map<Key, T, Compare, Alloc>& y)
+	{ return ft::lexicographical_compare(x.begin(), x.end(), y.begin(), y.end()); }
+
+	_HEADER_PMAP
+	inline bool	operator!=(const persistent_map<Key, T, Compare, Alloc>& x, const persistent_map<Key, T, Compare, Alloc>& y)
+	{ return !(x == y); }
+
+	_HEADER_PMAP
+	inline bool	operator>(const persistent_map<Key, T, Compare, Alloc>& x, const persistent_map<Key, T, Compare, Alloc>& y)
+	{ return y < x; }
+
+	_HEADER_PMAP
+	inline bool	operator>=(const persistent_map<Key, T, Compare, Alloc>& x, const persistent_map<Key, T, Compare, Alloc>& y)
+	{ return !(x < y); }
+
+	_HEADER_PMAP
+	inline bool	operator<=(const persistent_map<Key, T, Compare, Alloc>& x, const persistent_map<Key, T, Compare, Alloc>& y)
+	{ return !(y < x); }
+
+	_HEADER_PMAP
+	void	swap(persistent_map<Key, T, Compare, Alloc>& x, persistent_map<Key, T, Compare, Alloc>& y)
+	{ x.swap(y); }
+
+}//namespace
+
+#endif
@@ -0,0 +1,200 @@
+#pragma once
+# ifndef POOL_ALLOCATOR_HPP
+# define POOL_ALLOCATOR_HPP
+
+# include <cstddef>
+# include <new>
+# include "refcount.hpp"
+# include "type_traits.hpp"
+
+namespace ft {
+
+	// Alignment of T, C++98 has no alignof, and the size of the pool slots
+	// holding a T: sizeof(T) rounded up to it, a pointer at least.
+	template <typename T>
+	struct	Pool_slot {
+		struct	Probe { char c; T t; };
+
+		static const size_t	align = sizeof(Probe) - sizeof(T);
+		static const size_t	unit = align < sizeof(void*) ? sizeof(void*) : align;
+		static const size_t	value = (sizeof(T) + unit - 1) / unit * unit;
+	};
+
+	// Free lists of fixed size slots, one per slot size up to max_slot
+	// bytes. A slot size is the object size rounded up to its alignment,
+	// and chunks are aligned on chunk_align, so every slot is aligned for
+	// the objects of its size. Chunks go back to the system when the last
+	// pool_allocator sharing the pool is destroyed. Not thread safe: the
+	// allocators sharing a pool must be used from one thread at a time.
+	class	Pool_resource {
+
+		public:
+			static const size_t	max_slot = 256;
+			static const size_t	chunk_align = 64;
+
+			Pool_resource() : refs(1), _chunks(0) {
+				for (size_t i = 0; i < _classes; ++i) {
+					_free[i] = 0;
+					_chunk_slots[i] = 0;
+				}
+			}
+
+			~Pool_resource() {
+				while (_chunks != 0) {
+					Chunk*	next = _chunks->next;
+
+					::operator delete(_chunks);
+					_chunks = next;
+				}
+			}
+
+			void*	allocate(size_t slot) {
+				Slot*&	head = _free[slot / sizeof(Slot) - 1];
+
+				if (head == 0)
+					_refill(slot);
+				Slot*	s = head;
+				head = s->next;
+				return s;
+			}
+
+			void	deallocate(void* p, size_t slot) {
+				Slot*&	head = _free[slot / sizeof(Slot) - 1];
+				Slot*	s = static_cast<Slot*>(p);
+
+				s->next = head;
+				head = s;
+			}
+
+			refcount_type	refs;
+
+		private:
+			struct	Slot { Slot* next; };
+			struct	Chunk { Chunk* next; };
+
+			static const size_t	_classes = max_slot / sizeof(Slot);
+
+			Pool_resource(const Pool_resource&);
+			Pool_resource&	operator=(const Pool_resource&);
+
+			void	_refill(size_t slot) {
+				size_t&	count = _chunk_slots[slot / sizeof(Slot) - 1];
+				size_t	n = count < 16 ? 16 : count * 2;
+				char*	raw = static_cast<char*>(::operator new(sizeof(Chunk) + chunk_align + n * slot));
+				size_t	base = reinterpret_cast<size_t>(raw + sizeof(Chunk));
+				char*	first = raw + sizeof(Chunk) + (chunk_align - base % chunk_align) % chunk_align;
+
+				reinterpret_cast<Chunk*>(raw)->next = _chunks;
+				_chunks = reinterpret_cast<Chunk*>(raw);
+				for (size_t i = n; i > 0; --i)
+					deallocate(first + (i - 1) * slot, slot);
+				count = n;
+			}
+
+			Slot*	_free[_classes];
+			size_t	_chunk_slots[_classes];
+			Chunk*	_chunks;
+	};
+
+	// Node allocator for containers that allocate one object at a time:
+	// single allocations go through the pool, bigger or over-aligned ones
+	// to operator new. Each default-constructed allocator owns a new pool,
+	// shared by its copies and rebinds, hence by a container and the
+	// containers copied from it. Allocators compare equal when they share
+	// a pool: build a list on another's get_allocator() for splice()
+	// between them to relink nodes rather than copy them.
+	template <typename T>
+	class	pool_allocator {
+
+		public:
+			typedef T			value_type;
+			typedef T*			pointer;
+			typedef const T*	const_pointer;
+			typedef T&			reference;
+			typedef const T&	const_reference;
+			typedef size_t		size_type;
+			typedef ptrdiff_t	difference_type;
+
+			template <typename U>
+			struct	rebind { typedef pool_allocator<U>	other; };
+
+			pool_allocator() : _pool(new Pool_resource()) {}
+			pool_allocator(const pool_allocator& x) : _pool(x._pool) { refcount_acquire(_pool->refs); }
+			template <typename U>
+			pool_allocator(const pool_allocator<U>& x) : _pool(x.resource()) { refcount_acquire(_pool->refs); }
+			~pool_allocator() { _drop(); }
+
+			pool_allocator&	operator=(const pool_allocator& x) {
+				refcount_acquire(x._pool->refs);
+				_drop();
+				_pool = x._pool;
+				return *this;
+			}
+
+			Pool_resource*	resource() const { return _pool; }
+
+			pointer			address(reference x) const { return &x; }
+			const_pointer	address(const_reference x) const { return &x; }
+
+			pointer	allocate(size_type n, const void* = 0) {
+				if (n == 1 && _pooled)
+					return static_cast<pointer>(_pool->allocate(_slot));
+				if (n > max_size())
+					throw std::bad_alloc();
+				if (_align <= _new_align)
+					return static_cast<pointer>(::operator new(n * sizeof(T)));
+
+				// over-aligned: the raw pointer sits just before the object
+				char*	raw = static_cast<char*>(::operator new(n * sizeof(T) + _align));
+				char*	p = raw + _align - reinterpret_cast<size_t>(raw) % _align;
+
+				reinterpret_cast<void**>(p)[-1] = raw;
+				return reinterpret_cast<pointer>(p);
+			}
+
+			void	deallocate(pointer p, size_type n) {
+				if (p == 0)
+					return ;
+				if (n == 1 && _pooled)
+					_pool->deallocate(p, _slot);
+				else if (_align <= _new_align)
+					::operator delete(p);
+				else
+					::operator delete(reinterpret_cast<void**>(p)[-1]);
+			}
+
+			size_type	max_size() const { return (size_t(-1) - _align) / sizeof(T); }
+
+			void	construct(pointer p, const T& val) { ::new(static_cast<void*>(p)) T(val); }
+			void	destroy(pointer p) { p->~T(); }
+
+		private:
+			static const size_t	_align = Pool_slot<T>::align;
+			static const size_t	_slot = Pool_slot<T>::value;
+			static const bool	_pooled = _slot <= Pool_resource::max_slot && _align <= Pool_resource::chunk_align;
+			// alignment operator new is assumed to give
+			static const size_t	_new_align = 2 * sizeof(void*);
+
+			void	_drop() {
+				if (refcount_release(_pool->refs))
+					delete _pool;
+			}
+
+			Pool_resource*	_pool;
+	};
+
+	template <typename Alloc>
+	struct	is_pool_allocator : public false_type {};
+
+	template <typename T>
+	struct	is_pool_allocator<pool_allocator<T> > : public true_type {};
+
+	template <typename T1, typename T2>
+	inline bool	operator==(const pool_allocator<T1>& x, const pool_allocator<T2>& y) { return x.resource() == y.resource(); }
+
+	template <typename T1, typename T2>
+	inline bool	operator!=(const pool_allocator<T1>& x, const pool_allocator<T2>& y) { return x.resource() != y.resource(); }
+
+}//namespace
+
+#endif
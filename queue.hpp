@@ -0,0 +1,139 @@
+#pragma once
+# ifndef QUEUE_HPP
+# define QUEUE_HPP
+
+# include "vector.hpp"
+# include "list.hpp"
+# include "functional.hpp"
+# include "heap_algo.hpp"
+
+# define _HEADER_QUEUE \
+	template <typename T, typename Container>
+
+namespace ft {
+
+	template <typename T, typename Container = ft::list<T> >
+	class	queue {
+
+		private:
+			Container	_c;
+
+		public:
+			typedef T			value_type;
+			typedef size_t		size_type;
+			typedef Container	container_type;
+
+			explicit	queue(const container_type& c = container_type()) : _c(c) {}
+			~queue() {}
+
+			bool				empty() const { return _c.empty(); }
+			size_type			size() const { return _c.size(); }
+			value_type&			front() { return _c.front(); }
+			const value_type&	front() const { return _c.front(); }
+			value_type&			back() { return _c.back(); }
+			const value_type&	back() const { return _c.back(); }
+			void				push(const value_type& val) { _c.push_back(val); }
+			void				pop() { _c.pop_front(); }
+
+		template <typename T1, typename C1>
+		friend bool	operator==(const queue<T1,C1>&, const queue<T1,C1>&);
+
+		template <typename T1, typename C1>
+		friend bool	operator<(const queue<T1,C1>&, const queue<T1,C1>&);
+	};
+
+	_HEADER_QUEUE
+	inline bool	operator==(const queue<T,Container>& x, const queue<T,Container>& y)
+	{ return x._c == y._c; }
+
+	_HEADER_QUEUE
+	inline bool	operator<(const queue<T,Container>& x, const queue<T,Container>& y)
+	{ return x._c < y._c; }
+
+	_HEADER_QUEUE
+	inline bool	operator!=(const queue<T,Container>& x, const queue<T,Container>& y)
+	{ return !(x == y); }
+
+	_HEADER_QUEUE
+	inline bool	operator<=(const queue<T,Container>& x, const queue<T,Container>& y)
+	{ return !(y < x); }
+
+	_HEADER_QUEUE
+	inline bool	operator>(const queue<T,Container>& x, const queue<T,Container>& y)
+	{ return y < x; }
+
+	_HEADER_QUEUE
+	inline bool	operator>=(const queue<T,Container>& x, const queue<T,Container>& y)
+	{ return !(x < y); }
+
+	// Arity is the fan-out of the heap: 4 keeps the children of a node
+	// on one cache line for small types and halves the depth of a binary heap.
+	template <typename T, typename Container = ft::vector<T>,
+			typename Compare = ft::less<typename Container::value_type>, size_t Arity = 4>
+	class	priority_queue {
+
+		private:
+			Container	_c;
+			Compare		_comp;
+
+		public:
+			typedef typename Container::value_type		value_type;
+			typedef typename Container::reference		reference;
+			typedef typename Container::const_reference	const_reference;
+			typedef typename Container::size_type		size_type;
+			typedef Container							container_type;
+			typedef Compare								value_compare;
+
+			explicit	priority_queue(const Compare& comp = Compare(), const container_type& c = container_type())
+			: _c(c), _comp(comp) { ft::make_heap<Arity>(_c.begin(), _c.end(), _comp); }
+
+			template <typename InputIterator>
+			priority_queue(InputIterator first, InputIterator last, const Compare& comp = Compare(), const container_type& c = container_type())
+			: _c(c), _comp(comp) {
+				_c.insert(_c.end(), first, last);
+				ft::make_heap<Arity>(_c.begin(), _c.end(), _comp);
+			}
+
+			~priority_queue() {}
+
+			bool			empty() const { return _c.empty(); }
+			size_type		size() const { return _c.size(); }
+			const_reference	top() const { return _c.front(); }
+
+			void	push(const value_type& val) {
+				_c.push_back(val);
+				ft::push_heap<Arity>(_c.begin(), _c.end(), _comp);
+			}
+
+			// Appends the whole range, then either sifts the new elements up
+			// one by one or rebuilds in O(n) when the batch outweighs the heap.
+			template <typename InputIterator>
+			void	push_range(InputIterator first, InputIterator last) {
+				const size_type	old_size = _c.size();
+
+				_c.insert(_c.end(), first, last);
+				if (_c.size() - old_size > old_size)
+					ft::make_heap<Arity>(_c.begin(), _c.end(), _comp);
+				else {
+					for (size_type n = old_size + 1; n <= _c.size(); ++n)
+						ft::push_heap<Arity>(_c.begin(), _c.begin() + n, _comp);
+				}
+			}
+
+			void	pop() {
+				ft::pop_heap<Arity>(_c.begin(), _c.end(), _comp);
+				_c.pop_back();
+			}
+
+			// pop() followed by push(val) with one sift instead of two.
+			void	pop_push(const value_type& val) {
+				if (_c.empty())
+					push(val);
+				else
+					ft::replace_heap_top<Arity>(_c.begin(), _c.end(), val, _comp);
+			}
+	};
+
+}//namespace
+
+#endif
@@ -0,0 +1,187 @@
+#pragma once
+# ifndef READ_MOSTLY_MAP_HPP
+# define READ_MOSTLY_MAP_HPP
+
+# include <mutex>
+# include "epoch.hpp"
+# include "persistent_map.hpp"
+# include "vector.hpp"
+
+namespace ft {
+
+	// RCU style map for tables that are read all the time and written
+	// rarely. Readers never block nor take a lock: a read pins an epoch
+	// (a thread_local lookup, a store to the thread's own slot and a
+	// seq_cst fence), loads the current immutable version with one
+	// acquire load, and unpins with a release store. Versions are
+	// persistent_maps: writers serialize on a mutex, derive the next
+	// version in O(log n) per change, sharing every node off the updated
+	// paths, and publish it. A replaced version still pinned is retired
+	// and freed by a later write or collect().
+	template <typename Key, typename T, typename Compare = ft::less<Key>,
+			typename Alloc = std::allocator<pair<const Key, T> > >
+	class	read_mostly_map {
+
+		public:
+			typedef	Key										key_type;
+			typedef	T										mapped_type;
+			typedef	pair<const Key, T>						value_type;
+			typedef	Compare									key_compare;
+			typedef	Alloc									allocator_type;
+			typedef	size_t									size_type;
+			typedef	persistent_map<Key, T, Compare, Alloc>	map_type;
+
+		private:
+			struct	Retired {
+				Retired() : version(0), epoch(0) {}
+				Retired(map_type* v, uint64_t e) : version(v), epoch(e) {}
+
+				map_type*	version;
+				uint64_t	epoch;
+			};
+
+			// Installs next, retires the previous version and frees every
+			// retired version no pinned reader can still hold.
+			void	_publish(map_type* next) {
+				Epoch_domain&	domain = Epoch_domain::instance();
+				map_type*		prev = _current.load(std::memory_order_relaxed);
+
+				_current.store(next, std::memory_order_seq_cst);
+				_retired.push_back(Retired(prev, domain.advance()));
+				_reclaim(domain);
+			}
+
+			void	_reclaim(Epoch_domain& domain) {
+				size_type	kept = 0;
+
+				for (size_type i = 0; i < _retired.size(); ++i) {
+					if (domain.quiescent_since(_retired[i].epoch))
+						delete _retired[i].version;
+					else
+						_retired[kept++] = _retired[i];
+				}
+				_retired.resize(kept);
+			}
+
+		public:
+			explicit read_mostly_map(const Compare& comp = Compare(), const allocator_type& alloc = allocator_type())
+			: _current(new map_type(comp, alloc)) {}
+
+			read_mostly_map(const read_mostly_map&) = delete;
+			read_mostly_map&	operator=(const read_mostly_map&) = delete;
+
+			// No reader may still be inside the map.
+			~read_mostly_map() {
+				for (size_type i = 0; i < _retired.size(); ++i)
+					delete _retired[i].version;
+				delete _current.load(std::memory_order_relaxed);
+			}
+
+			//Readers, wait-free once the thread holds an epoch slot
+			template <typename Fn>
+			void	read(Fn fn) const {
+				epoch_guard	g;
+
+				fn(static_cast<const map_type&>(*_current.load(std::memory_order_acquire)));
+			}
+
+			bool	find(const key_type& k, mapped_type& out) const {
+				epoch_guard						g;
+				const map_type&					m = *_current.load(std::memory_order_acquire);
+				typename map_type::const_iterator	it = m.find(k);
+
+				if (it == m.end())
+					return false;
+				out = it->second;
+				return true;
+			}
+
+			bool	contains(const key_type& k) const {
+				epoch_guard		g;
+				const map_type&	m = *_current.load(std::memory_order_acquire);
+
+				return m.find(k) != m.end();
+			}
+
+			size_type	size() const {
+				epoch_guard	g;
+
+				return _current.load(std::memory_order_acquire)->size();
+			}
+
+			bool	empty() const { return size() == 0; }
+
+			// The current version, kept alive by the returned copy: O(1).
+			map_type	snapshot() const {
+				epoch_guard	g;
+
+				return *_current.load(std::memory_order_acquire);
+			}
+
+			//Writers, serialized
+			// Hands fn(map_type&) a private copy of the current version, which
+			// fn replaces by the versions it derives (m = m.assign(k, v)), and
+			// publishes the result: batch changes to publish them at once.
+			template <typename Fn>
+			void	update(Fn fn) {
+				std::lock_guard<std::mutex>	lock(_writer);
+				map_type*					next = new map_type(*_current.load(std::memory_order_relaxed));
+
+				try {
+					fn(*next);
+				}
+				catch (...) {
+					delete next;
+					throw ;
+				}
+				_publish(next);
+			}
+
+			bool	insert_or_assign(const key_type& k, const mapped_type& val) {
+				bool	inserted = false;
+
+				update([&](map_type& m) {
+					const size_type	n = m.size();
+
+					m = m.assign(k, val);
+					inserted = m.size() != n;
+				});
+				return inserted;
+			}
+
+			size_type	erase(const key_type& k) {
+				size_type	n = 0;
+
+				update([&](map_type& m) {
+					n = m.size();
+					m = m.erase(k);
+					n -= m.size();
+				});
+				return n;
+			}
+
+			void	clear() {
+				std::lock_guard<std::mutex>	lock(_writer);
+				const map_type*				cur = _current.load(std::memory_order_relaxed);
+
+				_publish(new map_type(cur->key_comp(), cur->get_allocator()));
+			}
+
+			// Frees the retired versions no reader can still see, without
+			// waiting for the next write. Returns how many are left.
+			size_type	collect() {
+				std::lock_guard<std::mutex>	lock(_writer);
+
+				_reclaim(Epoch_domain::instance());
+				return _retired.size();
+			}
+
+		private:
+			std::atomic<map_type*>	_current;
+			std::mutex				_writer;
+			ft::vector<Retired>		_retired;
+	};
+
+}//namespace
+
+#endif
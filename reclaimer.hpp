@@ -0,0 +1,148 @@
+#pragma once
+# ifndef RECLAIMER_HPP
+# define RECLAIMER_HPP
+
+# include <condition_variable>
+# include <mutex>
+# include "concurrent_base.hpp"
+# include "pool_allocator.hpp"
+# include "vector.hpp"
+
+namespace ft {
+
+	// Background thread destroying containers handed over by
+	// deferred_clear(), so that the caller does not pay for freeing
+	// millions of nodes. Started on first use, drained at exit.
+	class	Reclaimer {
+
+		public:
+			static Reclaimer&	instance() {
+				static Reclaimer	reclaimer;
+				return reclaimer;
+			}
+
+			// Deletes p on the reclaimer thread. After shutdown, or if the
+			// thread cannot be started, the deletion happens right here.
+			template <typename T>
+			void	post(T* p) {
+				bool	queued = false;
+
+				{
+					std::lock_guard<std::mutex>	lock(_mutex);
+
+					if (!_stop) {
+						try {
+							_start();
+							_jobs.push_back(Job(&_delete<T>, p));
+							++_pending;
+							queued = true;
+						}
+						catch (...) {}
+					}
+				}
+				if (queued)
+					_wake.notify_one();
+				else
+					delete p;
+			}
+
+			// Blocks until every container posted so far is destroyed.
+			void	flush() {
+				std::unique_lock<std::mutex>	lock(_mutex);
+
+				_idle.wait(lock, [this]() { return _pending == 0; });
+			}
+
+		private:
+			struct	Job {
+				Job() : run(0), arg(0) {}
+				Job(void (*f)(void*), void* a) : run(f), arg(a) {}
+
+				void	(*run)(void*);
+				void*	arg;
+			};
+
+			template <typename T>
+			static void	_delete(void* p) { delete static_cast<T*>(p); }
+
+			Reclaimer() : _stop(false), _pending(0) {}
+
+			~Reclaimer() {
+				{
+					std::lock_guard<std::mutex>	lock(_mutex);
+
+					_stop = true;
+					_wake.notify_one();
+				}
+				if (_thread.joinable())
+					_thread.join();
+			}
+
+			Reclaimer(const Reclaimer&) = delete;
+			Reclaimer&	operator=(const Reclaimer&) = delete;
+
+			// Called with _mutex held.
+			void	_start() {
+				if (!_thread.joinable())
+					_thread = std::thread(&Reclaimer::_loop, this);
+			}
+
+			// Takes the whole queue at once and runs it without the lock.
+			void	_loop() {
+				ft::vector<Job>					batch;
+				std::unique_lock<std::mutex>	lock(_mutex);
+
+				for (;;) {
+					_wake.wait(lock, [this]() { return _stop || !_jobs.empty(); });
+					if (_jobs.empty())
+						return ;
+					batch.swap(_jobs);
+					lock.unlock();
+					for (size_t i = 0; i < batch.size(); ++i)
+						batch[i].run(batch[i].arg);
+					lock.lock();
+					_pending -= batch.size();
+					batch.clear();
+					if (_pending == 0)
+						_idle.notify_all();
+				}
+			}
+
+			std::mutex				_mutex;
+			std::condition_variable	_wake;
+			std::condition_variable	_idle;
+			ft::vector<Job>			_jobs;
+			bool					_stop;
+			size_t					_pending;
+			std::thread				_thread;
+	};
+
+	// An empty container on the comparator and allocator of c.
+	template <typename Container>
+	Container*	new_empty_like(const Container& c, typename Container::key_compare*) {
+		return new Container(c.key_comp(), c.get_allocator());
+	}
+
+	template <typename Container>
+	Container*	new_empty_like(const Container& c, ...) {
+		return new Container(c.get_allocator());
+	}
+
+	// Empties c in O(1): its elements move to a heap container that the
+	// reclaimer thread destroys. c keeps its comparator and allocator.
+	// Works with every ft container whose swap() is O(1) (vector, list,
+	// map, set), but not on a pool_allocator: the reclaimer would free
+	// into a pool the owner thread keeps allocating from.
+	template <typename Container>
+	void	deferred_clear(Container& c) {
+		static_assert(!is_pool_allocator<typename Container::allocator_type>::value,
+			"deferred_clear: pool_allocator is not thread safe");
+		Container*	tmp = new_empty_like(c, 0);
+
+		tmp->swap(c);
+		Reclaimer::instance().post(tmp);
+	}
+
+}//namespace
+
+#endif
@@ -0,0 +1,23 @@
+#pragma once
+# ifndef REFCOUNT_HPP
+# define REFCOUNT_HPP
+
+# include <cstddef>
+
+namespace ft {
+
+	// Thread-safe reference counts for structures shared between copies.
+	// Compiler builtins keep them usable from C++98 code.
+	typedef size_t	refcount_type;
+
+	inline void	refcount_acquire(refcount_type& n) { __atomic_fetch_add(&n, 1, __ATOMIC_RELAXED); }
+
+	// True when the caller dropped the last reference.
+	inline bool	refcount_release(refcount_type& n) { return __atomic_sub_fetch(&n, 1, __ATOMIC_ACQ_REL) == 0; }
+
+	// True when the caller holds the only reference and may write in place.
+	inline bool	refcount_unique(const refcount_type& n) { return __atomic_load_n(&n, __ATOMIC_ACQUIRE) == 1; }
+
+}//namespace
+
+#endif
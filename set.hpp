@@ -8,9 +8,11 @@
 namespace ft {
 
 # define _HEADER_SET \
-	template <typename T, typename Compare, typename Alloc>
+	template <typename T, typename Compare, typename Alloc, typename Cache, typename Balance>
 
-	template <typename Key, typename Compare = less<Key>, typename Alloc = std::allocator<Key> >
+	// Cache is the lookup policy of the tree, see Rb_cache.hpp, Balance
+	// its balancing policy, Rb_balance or Splay_balance.
+	template <typename Key, typename Compare = less<Key>, typename Alloc = std::allocator<Key>, typename Cache = Rb_no_cache, typename Balance = Rb_balance>
 	class	set {
 
 		public:
@@ -25,7 +27,7 @@ namespace ft {
 			typedef typename Alloc::const_pointer	const_pointer;
 
 		private:
-			typedef Rb_tree<key_type, value_type, Identity<value_type>, key_compare, Alloc>	Tree;
+			typedef Rb_tree<key_type, value_type, Identity<value_type>, key_compare, Alloc, Cache, Balance>	Tree;
 
 			Tree	_t;
 
@@ -81,44 +83,64 @@ namespace ft {
 			//observers
 			key_compare		key_comp() const { return _t.key_comp(); }
 			value_compare	value_comp() const { return _t.key_comp(); }
+			const Cache&	lookup_cache() const { return _t.lookup_cache(); }
 
 			//operations
 			iterator	find(const value_type& val) const { return _t.find(val); }
 			size_type	count(const value_type& val) const { return _t.find(val) == _t.end() ? 0 : 1; }
 			iterator	lower_bound(const value_type& val) const { return _t.lower_bound(val); }
 			iterator	upper_bound(const value_type& val) const { return _t.upper_bound(val); }
+			// Lookups starting from hint, cheap when val is close to it.
+			iterator	find(iterator hint, const value_type& val) const { return _t.find(hint, val); }
+			iterator	lower_bound(iterator hint, const value_type& val) const { return _t.lower_bound(hint, val); }
 			pair<iterator, iterator>
 			equal_range(const value_type& val) const { return _t.equal_range(val); }
+
+			//batched lookups
+			// One iterator, or one bool, per value of [first, last), see
+			// Rb_tree::find_many.
+			template <typename ForwardIterator, typename OutputIterator>
+			OutputIterator	find_many(ForwardIterator first, ForwardIterator last, OutputIterator out) const { return _t.find_many(first, last, out); }
+			template <typename ForwardIterator, typename OutputIterator>
+			OutputIterator	contains_many(ForwardIterator first, ForwardIterator last, OutputIterator out) const { return _t.contains_many(first, last, out); }
+
+			//scans
+			// fn(const value_type&) is called in order until it returns false,
+			// see Rb_tree::for_each.
+			template <typename Fn>
+			bool	for_each(Fn fn) const { return _t.for_each(fn); }
+			template <typename Fn>
+			bool	for_each_in_range(const value_type& lo, const value_type& hi, Fn fn) const { return _t.for_each_in_range(lo, hi, fn); }
 			allocator_type	get_allocator() const { return _t.get_allocator(); }
 
-		template <typename K1, typename C1, typename A1>
-		friend bool	operator==(const set<K1, C1, A1>&, const set<K1, C1, A1>&);
+		template <typename K1, typename C1, typename A1, typename H1, typename B1>
+		friend bool	operator==(const set<K1, C1, A1, H1, B1>&, const set<K1, C1, A1, H1, B1>&);
 
-		template <typename K1, typename C1, typename A1>
-		friend bool	operator<(const set<K1, C1, A1>&, const set<K1, C1, A1>&);
+		template <typename K1, typename C1, typename A1, typename H1, typename B1>
+		friend bool	operator<(const set<K1, C1, A1, H1, B1>&, const set<K1, C1, A1, H1, B1>&);
 
 	};
 
 	_HEADER_SET
-	inline bool	operator==(const set<T,Compare,Alloc>& x, const set<T,Compare,Alloc>& y) { return x._t == y._t; }
+	inline bool	operator==(const set<T,Compare,Alloc,Cache,Balance>& x, const set<T,Compare,Alloc,Cache,Balance>& y) { return x._t == y._t; }
 
 	_HEADER_SET
-	inline bool	operator<(const set<T,Compare,Alloc>& x, const set<T,Compare,Alloc>& y) { return  x._t < y._t; }
+	inline bool	operator<(const set<T,Compare,Alloc,Cache,Balance>& x, const set<T,Compare,Alloc,Cache,Balance>& y) { return  x._t < y._t; }
 
 	_HEADER_SET
-	inline bool	operator!=(const set<T,Compare,Alloc>& x, const set<T,Compare,Alloc>& y) { return !(x == y); }
+	inline bool	operator!=(const set<T,Compare,Alloc,Cache,Balance>& x, const set<T,Compare,Alloc,Cache,Balance>& y) { return !(x == y); }
 
 	_HEADER_SET
-	inline bool	operator<=(const set<T,Compare,Alloc>& x, const set<T,Compare,Alloc>& y) { return !(y < x); }
+	inline bool	operator<=(const set<T,Compare,Alloc,Cache,Balance>& x, const set<T,Compare,Alloc,Cache,Balance>& y) { return !(y < x); }
 
 	_HEADER_SET
-	inline bool	operator>(const set<T,Compare,Alloc>& x, const set<T,Compare,Alloc>& y) { return y < x; }
+	inline bool	operator>(const set<T,Compare,Alloc,Cache,Balance>& x, const set<T,Compare,Alloc,Cache,Balance>& y) { return y < x; }
 
 	_HEADER_SET
-	inline bool	operator>=(const set<T,Compare,Alloc>& x, const set<T,Compare,Alloc>& y) { return !(x < y); }
+	inline bool	operator>=(const set<T,Compare,Alloc,Cache,Balance>& x, const set<T,Compare,Alloc,Cache,Balance>& y) { return !(x < y); }
 
 	_HEADER_SET
-	inline void	swap(set<T, Compare, Alloc>& x, set<T, Compare, Alloc>& y) { x.swap(y); }
+	inline void	swap(set<T, Compare, Alloc, Cache, Balance>& x, set<T, Compare, Alloc, Cache, Balance>& y) { x.swap(y); }
 
 }//namespace
 
@@ -0,0 +1,183 @@
+#pragma once
+# ifndef SPSC_QUEUE_HPP
+# define SPSC_QUEUE_HPP
+
+# include <memory>
+# include <new>
+# include <utility>
+# include <stdexcept>
+# include "concurrent_base.hpp"
+
+namespace ft {
+
+	// Bounded single producer / single consumer ring. Exactly one thread
+	// may push and one other thread may pop. _head and _tail only grow,
+	// the slot is the counter masked by the power of two capacity.
+	template <typename T, typename Alloc = std::allocator<T> >
+	class	spsc_queue {
+
+		public:
+			typedef T										value_type;
+			typedef size_t									size_type;
+			typedef Alloc									allocator_type;
+
+		private:
+			typedef std::allocator_traits<Alloc>			Traits;
+			typedef typename Traits::pointer				pointer;
+
+			// each side owns one line: its index plus a cached copy of the
+			// other side's index, reloaded only when the ring looks full/empty
+			struct	Side {
+				std::atomic<size_type>	index;
+				size_type				cached;
+
+				Side() : index(0), cached(0) {}
+			};
+
+			// Past half the range there is no power of two left to round to.
+			static size_type	_round_up(size_type n) {
+				size_type	cap = 1;
+
+				if (n > size_type(-1) / 2 + 1)
+					throw std::length_error("spsc_queue::spsc_queue");
+
+				while (cap < n)
+					cap <<= 1;
+				return cap;
+			}
+
+		public:
+			explicit spsc_queue(size_type capacity, const allocator_type& alloc = allocator_type())
+			: _impl(alloc), _mask(_round_up(capacity ? capacity : 1) - 1) {
+				if (_mask + 1 > Traits::max_size(_impl))
+					throw std::length_error("spsc_queue::spsc_queue");
+				_buf = Traits::allocate(_impl, _mask + 1);
+			}
+
+			spsc_queue(const spsc_queue&) = delete;
+			spsc_queue&	operator=(const spsc_queue&) = delete;
+
+			~spsc_queue() {
+				size_type	head = _consumer.value.index.load(std::memory_order_relaxed);
+				const size_type	tail = _producer.value.index.load(std::memory_order_relaxed);
+
+				for (; head != tail; ++head)
+					Traits::destroy(_impl, _buf + (head & _mask));
+				Traits::deallocate(_impl, _buf, _mask + 1);
+			}
+
+			size_type	capacity() const { return _mask + 1; }
+
+			// Only exact when both sides are quiescent.
+			size_type	size_approx() const {
+				const size_type	head = _consumer.value.index.load(std::memory_order_acquire);
+				return _producer.value.index.load(std::memory_order_acquire) - head;
+			}
+
+			bool	empty() const { return size_approx() == 0; }
+
+			//Producer side
+			bool	try_push(const value_type& val) { return _emplace(val); }
+			bool	try_push(value_type&& val) { return _emplace(std::move(val)); }
+
+			// Pushes up to n elements, publishes them with a single release
+			// store and returns how many fit. If a copy throws, the elements
+			// before it are published and the exception goes through.
+			template <typename InputIterator>
+			size_type	push_n(InputIterator first, size_type n) {
+				Side&			p = _producer.value;
+				const size_type	tail = p.index.load(std::memory_order_relaxed);
+
+				if (_mask + 1 - (tail - p.cached) < n)
+					p.cached = _consumer.value.index.load(std::memory_order_acquire);
+				const size_type	room = _mask + 1 - (tail - p.cached);
+
+				if (n > room)
+					n = room;
+				size_type	i = 0;
+
+				try {
+					for (; i < n; ++i, ++first)
+						Traits::construct(_impl, _buf + ((tail + i) & _mask), *first);
+				}
+				catch (...) {
+					p.index.store(tail + i, std::memory_order_release);
+					throw ;
+				}
+				p.index.store(tail + n, std::memory_order_release);
+				return n;
+			}
+
+			//Consumer side
+			bool	try_pop(value_type& out) {
+				Side&			c = _consumer.value;
+				const size_type	head = c.index.load(std::memory_order_relaxed);
+
+				if (head == c.cached) {
+					c.cached = _producer.value.index.load(std::memory_order_acquire);
+					if (head == c.cached)
+						return false;
+				}
+				pointer	slot = _buf + (head & _mask);
+				out = std::move(*slot);
+				Traits::destroy(_impl, slot);
+				c.index.store(head + 1, std::memory_order_release);
+				return true;
+			}
+
+			// Pops up to n elements into out, frees their slots with a single
+			// release store and returns how many were popped. If a move
+			// throws, the slots already freed are released and the element
+			// that threw stays at the head.
+			template <typename OutputIterator>
+			size_type	pop_n(OutputIterator out, size_type n) {
+				Side&			c = _consumer.value;
+				const size_type	head = c.index.load(std::memory_order_relaxed);
+
+				if (c.cached - head < n)
+					c.cached = _producer.value.index.load(std::memory_order_acquire);
+				if (c.cached - head < n)
+					n = c.cached - head;
+				size_type	i = 0;
+
+				try {
+					for (; i < n; ++i, ++out) {
+						pointer	slot = _buf + ((head + i) & _mask);
+						*out = std::move(*slot);
+						Traits::destroy(_impl, slot);
+					}
+				}
+				catch (...) {
+					c.index.store(head + i, std::memory_order_release);
+					throw ;
+				}
+				c.index.store(head + n, std::memory_order_release);
+				return n;
+			}
+
+		private:
+			template <typename U>
+			bool	_emplace(U&& val) {
+				Side&			p = _producer.value;
+				const size_type	tail = p.index.load(std::memory_order_relaxed);
+
+				if (tail - p.cached == _mask + 1) {
+					p.cached = _consumer.value.index.load(std::memory_order_acquire);
+					if (tail - p.cached == _mask + 1)
+						return false;
+				}
+				Traits::construct(_impl, _buf + (tail & _mask), std::forward<U>(val));
+				p.index.store(tail + 1, std::memory_order_release);
+				return true;
+			}
+
+			allocator_type		_impl;
+			pointer				_buf;
+			size_type			_mask;
+			cache_padded<Side>	_producer;
+			cache_padded<Side>	_consumer;
+	};
+
+}//namespace
+
+#endif
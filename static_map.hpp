@@ -0,0 +1,223 @@
+#pragma once
+# ifndef STATIC_MAP_HPP
+# define STATIC_MAP_HPP
+
+# if __cplusplus < 201402L
+#  error "static_map is built by constexpr loops, build with -std=c++14 or later"
+# endif
+
+# include <cstddef>
+# include <stdexcept>
+# if __cplusplus >= 201703L
+#  include <string_view>
+# endif
+# include "utility.hpp"
+
+namespace ft {
+
+	// 64-bit hash of a key, mixed with a seed by static_map. Integral and
+	// enum keys hash to themselves, strings with FNV-1a.
+	template <typename Key>
+	struct	static_hash {
+		constexpr unsigned long long	operator()(const Key& k) const { return static_cast<unsigned long long>(k); }
+	};
+
+	template <>
+	struct	static_hash<const char*> {
+		constexpr unsigned long long	operator()(const char* s) const {
+			unsigned long long	h = 0xcbf29ce484222325ULL;
+
+			for (; *s; ++s)
+				h = (h ^ static_cast<unsigned char>(*s)) * 0x100000001b3ULL;
+			return h;
+		}
+	};
+
+	template <typename Key>
+	struct	static_equal {
+		constexpr bool	operator()(const Key& x, const Key& y) const { return x == y; }
+	};
+
+	template <>
+	struct	static_equal<const char*> {
+		constexpr bool	operator()(const char* x, const char* y) const {
+			while (*x && *x == *y) {
+				++x;
+				++y;
+			}
+			return *x == *y;
+		}
+	};
+
+# if __cplusplus >= 201703L
+	template <>
+	struct	static_hash<std::string_view> {
+		constexpr unsigned long long	operator()(std::string_view s) const {
+			unsigned long long	h = 0xcbf29ce484222325ULL;
+
+			for (char c : s)
+				h = (h ^ static_cast<unsigned char>(c)) * 0x100000001b3ULL;
+			return h;
+		}
+	};
+# endif
+
+	// Read-only map of N entries fixed at compile time, with a minimal
+	// perfect hash found by hash and displace: the keys are spread over N
+	// buckets, then each bucket, largest first, gets a seed sending all
+	// its keys to free slots of the N-slot table. Single-key buckets store
+	// their slot directly. A lookup is one key hash, two mixes and one key
+	// comparison, with no allocation and nothing to build at startup:
+	//
+	//	constexpr ft::static_map<const char*, int, 2>	methods({{"GET", 1}, {"PUT", 2}});
+	//
+	// Duplicate keys, or distinct keys with equal 64-bit hashes, fail the
+	// constant evaluation.
+	template <typename Key, typename T, size_t N, typename Hash = static_hash<Key>, typename Equal = static_equal<Key> >
+	class	static_map {
+
+		public:
+			typedef Key					key_type;
+			typedef T					mapped_type;
+			typedef pair<Key, T>		value_type;
+			typedef size_t				size_type;
+			typedef ptrdiff_t			difference_type;
+			typedef Hash				hasher;
+			typedef Equal				key_equal;
+			typedef const value_type&	const_reference;
+			typedef const value_type*	const_iterator;
+			typedef const value_type*	iterator;
+
+		private:
+			static_assert(N != 0, "static_map needs at least one entry");
+
+			// Seed tries per bucket before giving up.
+			enum { _max_tries = 1 << 16 };
+
+		public:
+			constexpr explicit static_map(const value_type (&items)[N]) : _items(), _seeds() {
+				unsigned long long	hashes[N] = {};
+				size_type			bucket[N] = {};
+				size_type			start[N + 1] = {};
+				size_type			members[N] = {};
+				size_type			slots[N] = {};
+				bool				used[N] = {};
+				size_type			largest = 0;
+				size_type			free_slot = 0;
+
+				// members[start[b], start[b + 1]) are the keys of bucket b
+				for (size_type i = 0; i < N; ++i) {
+					hashes[i] = Hash()(items[i].first);
+					bucket[i] = _mix(hashes[i], 0) % N;
+					++start[bucket[i] + 1];
+				}
+				for (size_type b = 0; b < N; ++b) {
+					if (start[b + 1] > largest)
+						largest = start[b + 1];
+					start[b + 1] += start[b];
+				}
+				for (size_type i = 0; i < N; ++i)
+					members[start[bucket[i]] + slots[bucket[i]]++] = i;
+				for (size_type size = largest; size > 1; --size) {
+					for (size_type b = 0; b < N; ++b) {
+						if (start[b + 1] - start[b] == size)
+							_displace(items, hashes, members + start[b], size, slots, used, b);
+					}
+				}
+				for (size_type b = 0; b < N; ++b) {
+					if (start[b + 1] - start[b] != 1)
+						continue ;
+					while (used[free_slot])
+						++free_slot;
+					used[free_slot] = true;
+					_items[free_slot] = items[members[start[b]]];
+					_seeds[b] = -static_cast<long long>(free_slot) - 1;
+				}
+			}
+
+			//iterators, in slot order
+			constexpr const_iterator	begin() const { return _items; }
+			constexpr const_iterator	end() const { return _items + N; }
+
+			//capacity
+			constexpr bool		empty() const { return N == 0; }
+			constexpr size_type	size() const { return N; }
+			constexpr size_type	max_size() const { return N; }
+
+			//element access
+			constexpr const mapped_type&	at(const key_type& k) const {
+				const_iterator	it = find(k);
+
+				if (it == end())
+					throw std::out_of_range("static_map::at");
+				return it->second;
+			}
+
+			//operations
+			constexpr const_iterator	find(const key_type& k) const {
+				unsigned long long	h = Hash()(k);
+				long long			seed = _seeds[_mix(h, 0) % N];
+				size_type			slot = seed < 0 ? static_cast<size_type>(-seed - 1) : _mix(h, seed) % N;
+
+				return Equal()(_items[slot].first, k) ? _items + slot : end();
+			}
+
+			constexpr size_type	count(const key_type& k) const { return find(k) != end(); }
+			constexpr bool		contains(const key_type& k) const { return find(k) != end(); }
+
+		private:
+			// splitmix64 finalizer over the key hash and the seed.
+			static constexpr unsigned long long	_mix(unsigned long long h, unsigned long long seed) {
+				h ^= seed * 0x9e3779b97f4a7c15ULL;
+				h = (h ^ (h >> 30)) * 0xbf58476d1ce4e5b9ULL;
+				h = (h ^ (h >> 27)) * 0x94d049bb133111ebULL;
+				return h ^ (h >> 31);
+			}
+
+			// Finds the first seed sending the size keys of bucket b to
+			// distinct free slots and places them.
+			constexpr void	_displace(const value_type (&items)[N], const unsigned long long* hashes, const size_type* keys, size_type size, size_type* slots, bool* used, size_type b) {
+				for (size_type i = 0; i < size; ++i) {
+					for (size_type j = 0; j < i; ++j) {
+						if (hashes[keys[i]] == hashes[keys[j]])
+							throw std::logic_error(Equal()(items[keys[i]].first, items[keys[j]].first)
+								? "static_map: duplicate key" : "static_map: keys with equal hashes");
+					}
+				}
+				for (long long seed = 1; seed <= _max_tries; ++seed) {
+					size_type	i = 0;
+
+					for (; i < size; ++i) {
+						size_type	j = 0;
+
+						slots[i] = _mix(hashes[keys[i]], seed) % N;
+						while (j < i && slots[j] != slots[i])
+							++j;
+						if (used[slots[i]] || j != i)
+							break ;
+					}
+					if (i != size)
+						continue ;
+					for (i = 0; i < size; ++i) {
+						used[slots[i]] = true;
+						_items[slots[i]] = items[keys[i]];
+					}
+					_seeds[b] = seed;
+					return ;
+				}
+				throw std::logic_error("static_map: no perfect hash found");
+			}
+
+			value_type	_items[N];
+			long long	_seeds[N];
+	};
+
+	// make_static_map<const char*, int>({{"GET", 1}, {"PUT", 2}}), with N
+	// counted from the list.
+	template <typename Key, typename T, typename Hash = static_hash<Key>, typename Equal = static_equal<Key>, size_t N>
+	constexpr static_map<Key, T, N, Hash, Equal>	make_static_map(const pair<Key, T> (&items)[N])
+	{ return static_map<Key, T, N, Hash, Equal>(items); }
+
+}//namespace
+
+#endif
@@ -6,10 +6,44 @@
 # include "algorithm.hpp"
 # include "iterator.hpp"
 # include "Rb_iterator.hpp"
+# include "Rb_cache.hpp"
+# include "Splay_algo.hpp"
+# include "Avl_algo.hpp"
+# include "functional.hpp"
+# include "type_traits.hpp"
+# include <new>
+# if __cplusplus >= 201103L
+#  include <atomic>
+#  include <exception>
+#  include <thread>
+#  include <utility>
+#  include "vector.hpp"
+# endif
+
+// Copies of trees with at least this many nodes are split over threads
+// (C++11 builds only).
+# ifndef FT_PARALLEL_COPY_MIN
+#  define FT_PARALLEL_COPY_MIN 65536
+# endif
+
+// Threads a parallel copy runs on, the calling one included; 0 takes
+// std::thread::hardware_concurrency().
+# ifndef FT_PARALLEL_COPY_THREADS
+#  define FT_PARALLEL_COPY_THREADS 0
+# endif
+
+// Number of descents find_many() and contains_many() run in lockstep.
+# ifndef FT_FIND_GROUP
+#  define FT_FIND_GROUP 16
+# endif
 
 namespace ft {
 
-	template <typename Key, typename Val, typename KeyOfValue, typename Compare, typename Alloc = std::allocator<Val> >
+	// A copied tree holds its nodes in one block (see _copy_tree()), given
+	// back to the allocator with the last of them only: erasing most of a
+	// copy frees no memory until it is cleared or destroyed. Copy what is
+	// left into another tree to release the block.
+	template <typename Key, typename Val, typename KeyOfValue, typename Compare, typename Alloc = std::allocator<Val>, typename Cache = Rb_no_cache, typename Balance = Rb_balance>
 	class	Rb_tree {
 
 		public:
@@ -29,25 +63,34 @@ namespace ft {
 			typedef Alloc									allocator_type;
 			typedef Rb_iterator<value_type>					iterator;
 			typedef Rb_Const_iterator<value_type>			const_iterator;
-			typedef ft::reverse_iterator<iterator>			reverse_iterator;
-			typedef ft::reverse_iterator<const_iterator>	const_reverse_iterator;
+			typedef Rb_reverse_iterator<iterator>			reverse_iterator;
+			typedef Rb_reverse_iterator<const_iterator>		const_reverse_iterator;
+
+		private:
+			typedef typename has_three_way<Compare, Key>::type	Three_way;
+			typedef typename Cache::enabled						Cached;
+			typedef typename Balance::balanced					Balanced;
+			// Whether lookups stop at an equal key: always with a three-way
+			// comparator, and with a self-adjusting tree whose hot keys sit
+			// near the root, where two comparisons per level beat a descent
+			// down to a leaf.
+			typedef integral_constant<bool, Three_way::value || !Balanced::value>	Early_exit;
+
+		public:
 
 			allocator_type	get_allocator() const { return this->_alloc; }
 
-			Rb_tree(const Compare& comp, const allocator_type& a) : _alloc(a), _node_count(0), _key_compare(comp) {
+			Rb_tree(const Compare& comp, const allocator_type& a)
+			: _alloc(a), _node_count(0), _key_compare(comp), _block(0), _block_size(0), _block_live(0) {
 				_root.color = _red;
-				_root.parent = 0;
-				_root.left = &this->_root;
-				_root.right = &this->_root;
+				_init_header();
 			}
 
-			Rb_tree(const Rb_tree& x) : _alloc(x._alloc), _key_compare(x._key_compare) {
-				if (x._root.parent != 0) {
-					_root.parent = _copy(x._root.parent, &this->_root);
-					_root.left = Rb_Node<Val>::minimum(_root.parent);
-					_root.right = Rb_Node<Val>::maximum(_root.parent);
-					_node_count = x._node_count;
-				}
+			Rb_tree(const Rb_tree& x)
+			: _alloc(x._alloc), _node_count(0), _key_compare(x._key_compare), _block(0), _block_size(0), _block_live(0) {
+				_root.color = _red;
+				_init_header();
+				_copy_tree(x);
 			}
 
 			~Rb_tree() { _erase(_root.parent); }
@@ -56,12 +99,7 @@ namespace ft {
 				if (this != &x) {
 					clear();
 					_key_compare = x._key_compare;
-					if (x._root.parent != 0) {
-						_root.parent = _copy(x._root.parent, &_root);
-						_root.left = Rb_Node<Val>::minimum(_root.parent);
-						_root.right = Rb_Node<Val>::maximum(_root.parent);
-						_node_count = x._node_count;
-					}
+					_copy_tree(x);
 				}
 				return *this;
 			}
@@ -70,14 +108,26 @@ namespace ft {
 				std::swap(_root.parent, t._root.parent);
 				std::swap(_root.left, t._root.left);
 				std::swap(_root.right, t._root.right);
-				_root.parent->parent = &this->_root;
-				t._root.parent->parent = &(t._root);
+# ifdef FT_RB_THREADED
+				std::swap(_root.prev, t._root.prev);
+				std::swap(_root.next, t._root.next);
+# endif
+				_fix_header();
+				t._fix_header();
 				std::swap(_node_count, t._node_count);
 				std::swap(_key_compare, t._key_compare);
+				std::swap(_alloc, t._alloc);
+				std::swap(_block, t._block);
+				std::swap(_block_size, t._block_size);
+				std::swap(_block_live, t._block_live);
+				_cache.swap(t._cache);
 			}
 
 			Compare	key_comp() const { return this->_key_compare; }
 
+			// The lookup policy, with its hit and miss counts if it keeps any.
+			const Cache&	lookup_cache() const { return _cache; }
+
 			iterator				begin() { return iterator(this->_root.left); }
 			const_iterator			begin() const { return const_iterator(this->_root.left); }
 			iterator				end() { return iterator(&this->_root); }
@@ -89,35 +139,88 @@ namespace ft {
 
 			bool		empty() const { return _node_count == 0; }
 			size_type	size() const { return _node_count; }
-			size_type	max_size() const { return Node_allocator().max_size(); }
+			size_type	max_size() const { return Node_allocator(_alloc).max_size(); }
 
 			pair<iterator, bool>	insert(const value_type& val) {
-				Node_ptr	x = _root.parent;
-				Node_ptr	y = &this->_root;
-				iterator	j(0);
-				bool 		comp = true;
+				Insert_pos	pos = locate(KeyOfValue()(val));
 
-				while (x != 0) {
-					y = x;
-					comp = _key_compare(KeyOfValue()(val), KeyOfValue()(x->value));
-					x = comp ? x->left : x->right;
+				if (pos.found)
+					return pair<iterator, bool>(iterator(pos.node), false);
+				return pair<iterator, bool>(insert_at(pos, val), true);
+			}
+
+			//single descent insertion
+			// Where a key goes: its node if found, else the parent to link
+			// it under and on which side. Valid until the tree changes.
+			struct	Insert_pos {
+				Node_ptr	node;
+				bool		found;
+				bool		left;
+			};
+
+			Insert_pos	locate(const key_type& k) {
+				Insert_pos	pos = _locate_hot(k, Cached());
+
+				if (pos.found)
+					_access(pos.node);
+				return pos;
+			}
+
+			// Links a node holding val, whose key was given to locate().
+			iterator	insert_at(const Insert_pos& pos, const value_type& val)
+			{ return _insert_at(pos.left, pos.node, val); }
+
+# if __cplusplus >= 201103L
+			// Same, building value_type(args...) right in the node.
+			template <typename... Args>
+			iterator	emplace_at(const Insert_pos& pos, Args&&... args) {
+				Node_ptr	z = Node_allocator(_alloc).allocate(1);
+
+				try {
+					::new(static_cast<void*>(&z->value)) value_type(std::forward<Args>(args)...);
 				}
-				j = iterator(y);
-				if (comp) {
-					if (j == begin())
-						return pair<iterator, bool>(_insert(x, y, val), true);
-					--j;
+				catch (...) {
+					Node_allocator(_alloc).deallocate(z, 1);
+					throw ;
+				}
+				return _link(pos.left, pos.node, z);
+			}
+# else
+			// Same, building value_type(a1, a2) right in the node.
+			template <typename A1, typename A2>
+			iterator	emplace_at(const Insert_pos& pos, const A1& a1, const A2& a2) {
+				Node_ptr	z = Node_allocator(_alloc).allocate(1);
+
+				try {
+					::new(static_cast<void*>(&z->value)) value_type(a1, a2);
+				}
+				catch (...) {
+					Node_allocator(_alloc).deallocate(z, 1);
+					throw ;
+				}
+				return _link(pos.left, pos.node, z);
+			}
+
+			template <typename A1, typename A2, typename A3>
+			iterator	emplace_at(const Insert_pos& pos, const A1& a1, const A2& a2, const A3& a3) {
+				Node_ptr	z = Node_allocator(_alloc).allocate(1);
+
+				try {
+					::new(static_cast<void*>(&z->value)) value_type(a1, a2, a3);
+				}
+				catch (...) {
+					Node_allocator(_alloc).deallocate(z, 1);
+					throw ;
 				}
-				if (_key_compare(KeyOfValue()(j._node->value), KeyOfValue()(val)))
-					return pair<iterator, bool>(_insert(x, y, val), true);
-				return pair<iterator, bool>(j, false);
+				return _link(pos.left, pos.node, z);
 			}
+# endif
 
 			iterator	insert(const_iterator position, const value_type& val) {
 				if (position._node == &this->_root) {
 					if (size() > 0 && _key_compare(KeyOfValue()(_root.right->value), KeyOfValue()(val)))
 						return _insert(0, _root.right, val);
-					return insert(val).first;
+					return _insert_near(position._node, val);
 				}
 				else if (_key_compare(KeyOfValue()(val), KeyOfValue()(position._node->value))) {
 					const_iterator	before = position;
@@ -129,7 +232,7 @@ namespace ft {
 							return _insert(0, before._node, val);
 						return _insert(position._node, position._node, val);
 					}
-					return insert(val).first;
+					return _insert_near(position._node, val);
 				}
 				else if (_key_compare(KeyOfValue()(position._node->value), KeyOfValue()(val))) {
 					const_iterator	after = position;
@@ -141,7 +244,7 @@ namespace ft {
 							return _insert(0, position._node, val);
 						return _insert(after._node, after._node, val);
 					}
-					return insert(val).first;
+					return _insert_near(position._node, val);
 				}
 				return iterator(const_cast<Node_ptr>(position._node));
 			}
@@ -175,22 +278,14 @@ namespace ft {
 			}
 
 			void	clear() {
+				_cache.clear();
 				_erase(_root.parent);
-				_root.left = &this->_root;
-				_root.parent = 0;
-				_root.right = &this->_root;
+				_init_header();
 				_node_count = 0;
 			}
 
-			iterator	find(const key_type& k) {
-				iterator	j = lower_bound(k);
-				return (j == end() || _key_compare(k, KeyOfValue()(j._node->value))) ? end() : j;
-			}
-
-			const_iterator	find(const key_type& k) const {
-				const_iterator	j = lower_bound(k);
-				return (j == end() || _key_compare(k, KeyOfValue()(j._node->value))) ? end() : j;
-			}
+			iterator		find(const key_type& k) { return iterator(const_cast<Node_ptr>(_access(_find_hot(k, Cached())))); }
+			const_iterator	find(const key_type& k) const { return const_iterator(_access(_find_hot(k, Cached()))); }
 
 			size_type	count(const key_type& k) const {
 				pair<const_iterator, const_iterator>	p = equal_range(k);
@@ -203,14 +298,28 @@ namespace ft {
 			iterator		upper_bound(const key_type& k) { return _upper_bound(_root.parent, &this->_root, k); }
 			const_iterator	upper_bound(const key_type& k) const { return _upper_bound(_root.parent, &this->_root, k); }
 
+			//hinted lookups
+			// Same as find(k) and lower_bound(k), starting from hint rather
+			// than from the root: O(log d) for a key d positions away.
+			iterator		find(const_iterator hint, const key_type& k)
+			{ return iterator(const_cast<Node_ptr>(_access(_find_near(hint._node, k)))); }
+			const_iterator	find(const_iterator hint, const key_type& k) const
+			{ return const_iterator(_access(_find_near(hint._node, k))); }
+			iterator		lower_bound(const_iterator hint, const key_type& k)
+			{ return iterator(const_cast<Node_ptr>(_lower_bound_near(hint._node, k))); }
+			const_iterator	lower_bound(const_iterator hint, const key_type& k) const
+			{ return const_iterator(_lower_bound_near(hint._node, k)); }
+
 			pair<iterator, iterator>	equal_range(const key_type& k) {
 				Node_ptr	x = _root.parent;
 				Node_ptr	y = &this->_root;
 
 				while (x != 0) {
-					if (_key_compare(KeyOfValue()(x->value), k))
+					int	c = _compare(k, KeyOfValue()(x->value), Three_way());
+
+					if (c > 0)
 						x = x->right;
-					else if (_key_compare(k, KeyOfValue()(x->value))) {
+					else if (c < 0) {
 						y = x;
 						x = x->left;
 					}
@@ -230,9 +339,11 @@ namespace ft {
 				Const_Node_ptr	y = &this->_root;
 
 				while (x != 0) {
-					if (_key_compare(KeyOfValue()(x->value), k))
+					int	c = _compare(k, KeyOfValue()(x->value), Three_way());
+
+					if (c > 0)
 						x = x->right;
-					else if (_key_compare(k, KeyOfValue()(x->value))) {
+					else if (c < 0) {
 						y = x;
 						x = x->left;
 					}
@@ -247,54 +358,665 @@ namespace ft {
 				return pair<const_iterator, const_iterator>(const_iterator(y), const_iterator(y));
 			}
 
+			//batched lookups
+			// find(*it) for every key of [first, last), written to out in
+			// order. Descents run FT_FIND_GROUP at a time in lockstep, each
+			// prefetching its next node, so that their cache misses overlap.
+			template <typename ForwardIterator, typename OutputIterator>
+			OutputIterator	find_many(ForwardIterator first, ForwardIterator last, OutputIterator out) {
+				Const_Node_ptr	found[FT_FIND_GROUP];
+
+				while (first != last) {
+					size_type	n = _find_group(first, last, found);
+					for (size_type i = 0; i < n; ++i)
+						*out++ = iterator(const_cast<Node_ptr>(found[i]));
+				}
+				return out;
+			}
+
+			template <typename ForwardIterator, typename OutputIterator>
+			OutputIterator	find_many(ForwardIterator first, ForwardIterator last, OutputIterator out) const {
+				Const_Node_ptr	found[FT_FIND_GROUP];
+
+				while (first != last) {
+					size_type	n = _find_group(first, last, found);
+					for (size_type i = 0; i < n; ++i)
+						*out++ = const_iterator(found[i]);
+				}
+				return out;
+			}
+
+			// Same, writing whether each key is present.
+			template <typename ForwardIterator, typename OutputIterator>
+			OutputIterator	contains_many(ForwardIterator first, ForwardIterator last, OutputIterator out) const {
+				Const_Node_ptr	found[FT_FIND_GROUP];
+
+				while (first != last) {
+					size_type	n = _find_group(first, last, found);
+					for (size_type i = 0; i < n; ++i)
+						*out++ = (found[i] != &this->_root);
+				}
+				return out;
+			}
+
+			//scans
+			// In-order visit of every value, or of those whose key lies in
+			// [lo, hi], calling fn(value) until it returns false. Returns false
+			// when fn stopped the scan.
+			template <typename Fn>
+			bool	for_each(Fn fn) { return _scan(_root.parent, 0, 0, fn, Balanced()); }
+			template <typename Fn>
+			bool	for_each(Fn fn) const { return _scan(static_cast<Const_Node_ptr>(_root.parent), 0, 0, fn, Balanced()); }
+			template <typename Fn>
+			bool	for_each_in_range(const key_type& lo, const key_type& hi, Fn fn) { return _scan(_root.parent, &lo, &hi, fn, Balanced()); }
+			template <typename Fn>
+			bool	for_each_in_range(const key_type& lo, const key_type& hi, Fn fn) const
+			{ return _scan(static_cast<Const_Node_ptr>(_root.parent), &lo, &hi, fn, Balanced()); }
+
 		private:
+			// Looks up the next FT_FIND_GROUP keys of [first, last) and
+			// advances first past them. Each round moves every unfinished
+			// descent one level down, as _lower_bound() would, so a group
+			// waits on up to FT_FIND_GROUP misses at once instead of one.
+			template <typename ForwardIterator>
+			size_type	_find_group(ForwardIterator& first, ForwardIterator last, Const_Node_ptr* found) const {
+				const key_type*	keys[FT_FIND_GROUP];
+				Const_Node_ptr	x[FT_FIND_GROUP];
+				Const_Node_ptr	end = &this->_root;
+				size_type		n = 0;
+				size_type		active;
+
+				for (; n < FT_FIND_GROUP && first != last; ++n, ++first) {
+					keys[n] = &*first;
+					x[n] = _root.parent;
+					found[n] = end;
+				}
+				active = (_root.parent != 0) ? n : 0;
+				while (active != 0) {
+					active = 0;
+					for (size_type i = 0; i < n; ++i) {
+						Const_Node_ptr	c = x[i];
+
+						if (c == 0)
+							continue ;
+						if (!_key_compare(KeyOfValue()(c->value), *keys[i])) {
+							found[i] = c;
+							c = c->left;
+						}
+						else
+							c = c->right;
+						if (c != 0) {
+							FT_PREFETCH(c);
+							++active;
+						}
+						x[i] = c;
+					}
+				}
+				for (size_type i = 0; i < n; ++i)
+					if (found[i] != end && _key_compare(*keys[i], KeyOfValue()(found[i]->value)))
+						found[i] = end;
+				return n;
+			}
+
+			// The stack holds the nodes left to visit, each above the left
+			// spine of its right subtree. Subtrees below lo are never pushed
+			// and the walk ends at the first key above hi.
+			template <typename Ptr, typename Fn>
+			bool	_scan(Ptr x, const key_type* lo, const key_type* hi, Fn& fn, true_type) const {
+				Ptr			stack[2 * sizeof(size_type) * 8];
+				unsigned	top = 0;
+
+				while (x != 0) {
+					if (lo == 0 || !_key_compare(KeyOfValue()(x->value), *lo)) {
+						stack[top++] = x;
+						x = x->left;
+					}
+					else
+						x = x->right;
+				}
+				while (top != 0) {
+					x = stack[--top];
+					if (hi != 0 && _key_compare(*hi, KeyOfValue()(x->value)))
+						return true;
+					if (!fn(x->value))
+						return false;
+					for (x = x->right; x != 0; x = x->left)
+						stack[top++] = x;
+				}
+				return true;
+			}
+
+			// Without a bound on the height the stack could overflow: step
+			// from node to node as iterators do instead.
+			template <typename Ptr, typename Fn>
+			bool	_scan(Ptr x, const key_type* lo, const key_type* hi, Fn& fn, false_type) const {
+				Ptr	y = const_cast<Node_ptr>(&this->_root);
+
+				while (x != 0) {
+					if (lo == 0 || !_key_compare(KeyOfValue()(x->value), *lo)) {
+						y = x;
+						x = x->left;
+					}
+					else
+						x = x->right;
+				}
+				for (; y != &this->_root; y = (++iterator(const_cast<Node_ptr>(y)))._node) {
+					if (hi != 0 && _key_compare(*hi, KeyOfValue()(y->value)))
+						return true;
+					if (!fn(y->value))
+						return false;
+				}
+				return true;
+			}
+
+			// Lets the balancing policy react to a lookup that found x, which
+			// only a self-adjusting one does. The header is left alone.
+			Const_Node_ptr	_access(Const_Node_ptr x) const {
+				if (x != &this->_root)
+					Balance::access(const_cast<Node_ptr>(x), const_cast<Rb_Node<Val>&>(this->_root));
+				return x;
+			}
+
 			Node_ptr	_create_node(const value_type& val) {
 				//use node allocator
-				Node_ptr	node = Node_allocator().allocate(1);
+				Node_ptr	node = Node_allocator(_alloc).allocate(1);
 
 				//use pair allocator
 				_alloc.construct(&node->value, val);
 				return node;
 			}
 
+			// Nodes of a copied tree live in one block, which goes back to
+			// the allocator with its last node.
 			void		_destroy_node(Node_ptr node) {
 				_alloc.destroy(&node->value);
-				Node_allocator().deallocate(node, 1);
+				if (node >= _block && node < _block + _block_size) {
+					if (--_block_live == 0) {
+						Node_allocator(_alloc).deallocate(_block, _block_size);
+						_block = 0;
+						_block_size = 0;
+					}
+				}
+				else
+					Node_allocator(_alloc).deallocate(node, 1);
 			}
 
-			Node_ptr	_clone_node(Const_Node_ptr node) {
-				Node_ptr	tmp = _create_node(node->value);
+			void	_init_header() {
+				_root.parent = 0;
+				_root.left = &this->_root;
+				_root.right = &this->_root;
+# ifdef FT_RB_THREADED
+				_root.prev = &this->_root;
+				_root.next = &this->_root;
+# endif
+			}
+
+			// Points the nodes of a swapped tree back at this header.
+			void	_fix_header() {
+				if (_root.parent == 0)
+					_init_header();
+				else {
+					_root.parent->parent = &this->_root;
+# ifdef FT_RB_THREADED
+					_root.next->prev = &this->_root;
+					_root.prev->next = &this->_root;
+# endif
+				}
+			}
+
+# ifdef FT_RB_THREADED
+			// Appends subtree r in order to the list ending at tail, walking
+			// the parent links so that any height will do.
+			static void	_thread(Node_ptr r, Node_ptr& tail) {
+				Node_ptr	x = r;
+
+				if (x == 0)
+					return ;
+				x = Rb_Node<Val>::minimum(x);
+				for (;;) {
+					tail->next = x;
+					x->prev = tail;
+					tail = x;
+					if (x->right != 0)
+						x = Rb_Node<Val>::minimum(x->right);
+					else {
+						while (x != r && x == x->parent->right)
+							x = x->parent;
+						if (x == r)
+							return ;
+						x = x->parent;
+					}
+				}
+			}
+# endif
+
+			// Clones node into the free slot, then moves slot past it.
+			Node_ptr	_clone_node(Const_Node_ptr node, Node_ptr& slot) {
+				_alloc.construct(&slot->value, node->value);
+				Node_ptr	tmp = slot++;
 				tmp->color = node->color;
 				tmp->left = 0;
 				tmp->right = 0;
 				return tmp;
 			}
 
-			Node_ptr	_copy(Const_Node_ptr x, Node_ptr p) {
-				Node_ptr	top = _clone_node(x);
+			Node_ptr	_copy(Const_Node_ptr x, Node_ptr p, Node_ptr& slot) { return _copy(x, p, slot, Balanced()); }
+
+			// Recurses on right children only, which a balanced tree keeps
+			// O(log n) deep.
+			Node_ptr	_copy(Const_Node_ptr x, Node_ptr p, Node_ptr& slot, true_type) {
+				Node_ptr	top = _clone_node(x, slot);
 
 				top->parent = p;
 				if (x->right)
-					top->right = _copy(x->right, top);
+					top->right = _copy(x->right, top, slot, true_type());
 				p = top;
 				x = x->left;
 				while (x != 0) {
-					Node_ptr	y = _clone_node(x);
+					Node_ptr	y = _clone_node(x, slot);
 					p->left = y;
 					y->parent = p;
 					if (x->right)
-						y->right = _copy(x->right, y);
+						y->right = _copy(x->right, y, slot, true_type());
 					p = y;
 					x = x->left;
 				}
 				return top;
 			}
 
+			// Pre-order copy going back up through the parent links of the
+			// source and of the clones, so the stack stays flat whatever the
+			// shape of x. A clone whose child link is still null has that
+			// subtree left to copy.
+			Node_ptr	_copy(Const_Node_ptr x, Node_ptr p, Node_ptr& slot, false_type) {
+				Const_Node_ptr	src = x;
+				Node_ptr		dst = _clone_node(x, slot);
+				Node_ptr		top = dst;
+
+				top->parent = p;
+				for (;;) {
+					if (src->left != 0 && dst->left == 0) {
+						src = src->left;
+						dst->left = _clone_node(src, slot);
+						dst->left->parent = dst;
+						dst = dst->left;
+					}
+					else if (src->right != 0 && dst->right == 0) {
+						src = src->right;
+						dst->right = _clone_node(src, slot);
+						dst->right->parent = dst;
+						dst = dst->right;
+					}
+					else if (src == x)
+						return top;
+					else {
+						src = src->parent;
+						dst = dst->parent;
+					}
+				}
+			}
+
+			// Copies x into an empty tree with a single allocation. Slots are
+			// filled in order, so on failure [block, slot) is what to undo.
+			void	_copy_tree(const Rb_tree& x) {
+				if (x._root.parent == 0)
+					return ;
+				const size_type	n = x._node_count;
+				Node_ptr		block = Node_allocator(_alloc).allocate(n);
+				Node_ptr		slot = block;
+
+				try {
+# if __cplusplus >= 201103L
+					if (n >= FT_PARALLEL_COPY_MIN && _copy_threads() > 1)
+						_root.parent = _copy_parallel(x._root.parent, slot);
+					else
+# endif
+						_root.parent = _copy(x._root.parent, &this->_root, slot);
+				}
+				catch (...) {
+					for (Node_ptr p = block; p != slot; ++p)
+						_alloc.destroy(&p->value);
+					Node_allocator(_alloc).deallocate(block, n);
+					_root.parent = 0;
+					throw ;
+				}
+				_block = block;
+				_block_size = n;
+				_block_live = n;
+				_root.left = Rb_Node<Val>::minimum(_root.parent);
+				_root.right = Rb_Node<Val>::maximum(_root.parent);
+# ifdef FT_RB_THREADED
+				Node_ptr	tail = &this->_root;
+
+				_thread(_root.parent, tail);
+				tail->next = &this->_root;
+				_root.prev = tail;
+# endif
+				_node_count = n;
+			}
+
+# if __cplusplus >= 201103L
+			enum { max_copy_threads = 64 };
+
+			static unsigned	_copy_threads() {
+				const unsigned	n = FT_PARALLEL_COPY_THREADS ? FT_PARALLEL_COPY_THREADS : std::thread::hardware_concurrency();
+
+				return std::min<unsigned>(n, max_copy_threads);
+			}
+
+			struct	Copy_task {
+				Const_Node_ptr		src;
+				Node_ptr			parent;
+				Node_ptr*			link;
+				size_type			size;
+				Node_ptr			first;
+				Node_ptr			last;
+				std::exception_ptr	error;
+			};
+
+			// Pre-order count of subtree r through the parent links.
+			static size_type	_count(Const_Node_ptr r) {
+				Const_Node_ptr	x = r;
+				size_type		n = 0;
+
+				if (x == 0)
+					return 0;
+				for (;;) {
+					++n;
+					if (x->left != 0)
+						x = x->left;
+					else if (x->right != 0)
+						x = x->right;
+					else {
+						for (;;) {
+							if (x == r)
+								return n;
+							if (x == x->parent->left && x->parent->right != 0) {
+								x = x->parent->right;
+								break ;
+							}
+							x = x->parent;
+						}
+					}
+				}
+			}
+
+			// Clones the nodes above depth cut and queues their children.
+			Node_ptr	_copy_top(Const_Node_ptr x, Node_ptr p, Node_ptr& slot, unsigned cut, ft::vector<Copy_task>& tasks) {
+				Node_ptr	top = _clone_node(x, slot);
+				Const_Node_ptr	child[2] = { x->left, x->right };
+				Node_ptr*		link[2] = { &top->left, &top->right };
+
+				top->parent = p;
+				for (int i = 0; i < 2; ++i) {
+					if (child[i] == 0)
+						continue ;
+					if (cut > 0)
+						*link[i] = _copy_top(child[i], top, slot, cut - 1, tasks);
+					else {
+						Copy_task	t = { child[i], top, link[i], 0, 0, 0, std::exception_ptr() };
+						tasks.push_back(t);
+					}
+				}
+				return top;
+			}
+
+			// Runs fn on each task from a shared counter, the calling thread
+			// included. Thread creation failures only lower the parallelism.
+			template <typename Fn>
+			static void	_run_tasks(ft::vector<Copy_task>& tasks, unsigned threads, Fn fn) {
+				std::atomic<size_type>	next(0);
+				std::thread				pool[max_copy_threads];
+				unsigned				spawned = 0;
+				auto					work = [&]() {
+					for (size_type i; (i = next.fetch_add(1, std::memory_order_relaxed)) < tasks.size(); )
+						fn(tasks[i]);
+				};
+
+				try {
+					for (; spawned + 1 < threads; ++spawned)
+						pool[spawned] = std::thread(work);
+				}
+				catch (...) {}
+				work();
+				for (unsigned i = 0; i < spawned; ++i)
+					pool[i].join();
+			}
+
+			// Splits the copy into subtrees below the first levels: one pass
+			// counts them to place each one in the block, a second copies
+			// them concurrently.
+			Node_ptr	_copy_parallel(Const_Node_ptr x, Node_ptr& slot) {
+				const unsigned			threads = _copy_threads();
+				unsigned				cut = 0;
+				ft::vector<Copy_task>	tasks;
+
+				while ((1u << cut) < threads * 8)
+					++cut;
+				Node_ptr	top = _copy_top(x, &this->_root, slot, cut, tasks);
+				Node_ptr	first = slot;
+
+				_run_tasks(tasks, threads, [](Copy_task& t) { t.size = _count(t.src); });
+				for (size_type i = 0; i < tasks.size(); ++i) {
+					tasks[i].first = first;
+					tasks[i].last = first;
+					first += tasks[i].size;
+				}
+				_run_tasks(tasks, threads, [this](Copy_task& t) {
+					try {
+						*t.link = _copy(t.src, t.parent, t.last);
+					}
+					catch (...) {
+						t.error = std::current_exception();
+					}
+				});
+				for (size_type i = 0; i < tasks.size(); ++i) {
+					if (tasks[i].error) {
+						for (size_type j = 0; j < tasks.size(); ++j)
+							for (Node_ptr p = tasks[j].first; p != tasks[j].last; ++p)
+								_alloc.destroy(&p->value);
+						std::rethrow_exception(tasks[i].error);
+					}
+				}
+				slot = first;
+				return top;
+			}
+# endif
+
+			// Three-way order of k against x, with one call when Compare has
+			// compare(), else with up to two.
+			int	_compare(const key_type& k, const key_type& x, true_type) const
+			{ return _key_compare.compare(k, x); }
+
+			int	_compare(const key_type& k, const key_type& x, false_type) const {
+				if (_key_compare(x, k))
+					return 1;
+				return _key_compare(k, x) ? -1 : 0;
+			}
+
+			// Early_exit picks the descent stopping at an equal key, or the
+			// lower bound with one check at the end.
+			Const_Node_ptr	_find(const key_type& k, true_type) const {
+				Const_Node_ptr	x = _root.parent;
+
+				while (x != 0) {
+					int	c = _compare(k, KeyOfValue()(x->value), Three_way());
+
+					if (c == 0)
+						return x;
+					x = c < 0 ? x->left : x->right;
+				}
+				return &this->_root;
+			}
+
+			Const_Node_ptr	_find(const key_type& k, false_type) const {
+				const_iterator	j = lower_bound(k);
+
+				return (j == end() || _key_compare(k, KeyOfValue()(j._node->value))) ? &this->_root : j._node;
+			}
+
+			// With a lookup cache, a hit skips the descent and a key found by
+			// a descent takes its slot.
+			Const_Node_ptr	_find_hot(const key_type& k, true_type) const {
+				Const_Node_ptr	x = static_cast<Const_Node_ptr>(_cache.get(k));
+
+				if (x != 0 && _compare(k, KeyOfValue()(x->value), Three_way()) == 0) {
+					++_cache.hits;
+					return x;
+				}
+				++_cache.misses;
+				x = _find(k, Early_exit());
+				if (x != &this->_root)
+					_cache.put(k, x);
+				return x;
+			}
+
+			Const_Node_ptr	_find_hot(const key_type& k, false_type) const { return _find(k, Early_exit()); }
+
+			Insert_pos	_locate_hot(const key_type& k, true_type) {
+				Node_ptr	x = const_cast<Node_ptr>(static_cast<Const_Node_ptr>(_cache.get(k)));
+				Insert_pos	pos;
+
+				if (x != 0 && _compare(k, KeyOfValue()(x->value), Three_way()) == 0) {
+					++_cache.hits;
+					pos.node = x;
+					pos.found = true;
+					pos.left = false;
+					return pos;
+				}
+				++_cache.misses;
+				pos = _locate(_root.parent, k, Early_exit());
+				if (pos.found)
+					_cache.put(k, pos.node);
+				return pos;
+			}
+
+			Insert_pos	_locate_hot(const key_type& k, false_type) { return _locate(_root.parent, k, Early_exit()); }
+
+			// Finger search: climbs from h to the root x of the smallest
+			// subtree whose key range holds k, strictly between the ancestors
+			// bounding it, so that every node equal to k lies below x. y is
+			// set to a node known to be a lower bound for k, if any, which is
+			// where _lower_bound() starts. h is a node, not the header.
+			Const_Node_ptr	_finger(Const_Node_ptr h, const key_type& k, Const_Node_ptr& y) const {
+				Const_Node_ptr	x = h;
+				Const_Node_ptr	p;
+
+				if (_key_compare(KeyOfValue()(h->value), k)) {
+					y = &this->_root;
+					while (x != _root.parent) {
+						p = x->parent;
+						if (x == p->left && _key_compare(k, KeyOfValue()(p->value))) {
+							y = p;
+							break ;
+						}
+						x = p;
+					}
+				}
+				else {
+					y = h;
+					while (x != _root.parent) {
+						p = x->parent;
+						if (x == p->right && _key_compare(KeyOfValue()(p->value), k))
+							break ;
+						x = p;
+					}
+				}
+				return x;
+			}
+
+			// The end hint stands for the last node, keys above it cost one
+			// comparison.
+			Const_Node_ptr	_lower_bound_near(Const_Node_ptr h, const key_type& k) const {
+				Const_Node_ptr	y;
+				Const_Node_ptr	x;
+
+				if (h == &this->_root) {
+					if (_node_count == 0 || _key_compare(KeyOfValue()(_root.right->value), k))
+						return &this->_root;
+					h = _root.right;
+				}
+				x = _finger(h, k, y);
+				return _lower_bound(x, y, k)._node;
+			}
+
+			Const_Node_ptr	_find_near(Const_Node_ptr h, const key_type& k) const {
+				Const_Node_ptr	j = _lower_bound_near(h, k);
+
+				return (j == &this->_root || _key_compare(k, KeyOfValue()(j->value))) ? &this->_root : j;
+			}
+
+			// Hinted insertion whose hint is not next to val.
+			iterator	_insert_near(Const_Node_ptr h, const value_type& val) {
+				const key_type&	k = KeyOfValue()(val);
+				Const_Node_ptr	y;
+				Insert_pos		pos;
+
+				if (_node_count == 0)
+					return insert(val).first;
+				if (h == &this->_root)
+					h = _root.right;
+				pos = _locate(const_cast<Node_ptr>(_finger(h, k, y)), k, Early_exit());
+				if (pos.found)
+					return iterator(pos.node);
+				return insert_at(pos, val);
+			}
+
+			// An equal key stops the descent, so no check is left at the end.
+			// Both start from x, the root or a subtree from _finger().
+			Insert_pos	_locate(Node_ptr x, const key_type& k, true_type) {
+				Insert_pos	pos = { &this->_root, false, true };
+
+				while (x != 0) {
+					int	c = _compare(k, KeyOfValue()(x->value), Three_way());
+
+					pos.node = x;
+					if (c == 0) {
+						pos.found = true;
+						return pos;
+					}
+					pos.left = c < 0;
+					x = pos.left ? x->left : x->right;
+				}
+				return pos;
+			}
+
+			// The descent finds where k would go, its predecessor then tells
+			// whether k is already there.
+			Insert_pos	_locate(Node_ptr x, const key_type& k, false_type) {
+				Insert_pos	pos = { &this->_root, false, true };
+				iterator	j(0);
+
+				while (x != 0) {
+					pos.node = x;
+					pos.left = _key_compare(k, KeyOfValue()(x->value));
+					x = pos.left ? x->left : x->right;
+				}
+				j = iterator(pos.node);
+				if (pos.left) {
+					if (j == begin())
+						return pos;
+					--j;
+				}
+				if (!_key_compare(KeyOfValue()(j._node->value), k)) {
+					pos.node = j._node;
+					pos.found = true;
+				}
+				return pos;
+			}
+
 			iterator	_insert(Const_Node_ptr x, Const_Node_ptr y, const value_type& val) {
-				bool		insert_left = (x != 0 || y == &this->_root || _key_compare(KeyOfValue()(val), KeyOfValue()(y->value)));
-				Node_ptr	z = _create_node(val);
+				bool	insert_left = (x != 0 || y == &this->_root || _key_compare(KeyOfValue()(val), KeyOfValue()(y->value)));
+
+				return _insert_at(insert_left, y, val);
+			}
+
+			// Links val as the left or right child of y, already known.
+			iterator	_insert_at(bool insert_left, Const_Node_ptr y, const value_type& val)
+			{ return _link(insert_left, y, _create_node(val)); }
 
-				insert_and_rebalance(insert_left, z, const_cast<Node_ptr>(y), this->_root);
+			iterator	_link(bool insert_left, Const_Node_ptr y, Node_ptr z) {
+				Balance::insert(insert_left, z, const_cast<Node_ptr>(y), this->_root);
 				++_node_count;
 				return iterator(z);
 			}
@@ -347,20 +1069,30 @@ namespace ft {
 				return const_iterator(y);
 			}
 
+			// Rotates left children up until x has none, then frees x: the
+			// stack stays flat whatever the height of the tree.
 			void	_erase(Node_ptr x) {
 				Node_ptr	y(0);
 
 				while (x != 0) {
-					_erase(x->right);
-					y = x->left;
-					_destroy_node(x);
-					x = y;
+					if (x->left != 0) {
+						y = x->left;
+						x->left = y->right;
+						y->right = x;
+						x = y;
+					}
+					else {
+						y = x->right;
+						_destroy_node(x);
+						x = y;
+					}
 				}
 			}
 
 			void	_erase_aux(const_iterator position) {
-				Node_ptr	y = rebalance_for_erase(const_cast<Node_ptr>(position._node), this->_root);
+				Node_ptr	y = Balance::erase(const_cast<Node_ptr>(position._node), this->_root);
 
+				_cache.erase(KeyOfValue()(y->value), y);
 				_destroy_node(y);
 				--_node_count;
 			}
@@ -379,26 +1111,30 @@ namespace ft {
 			size_type		_node_count;
 			Compare			_key_compare;
 			Rb_Node<Val>	_root;
+			Node_ptr		_block;
+			size_type		_block_size;
+			size_type		_block_live;
+			mutable Cache	_cache;
 
 	};
 
-	template <typename Key, typename Val, typename KeyOfValue, typename Compare, typename Alloc>
-	inline bool	operator==(const Rb_tree<Key, Val, KeyOfValue, Compare, Alloc>& x, const Rb_tree<Key, Val, KeyOfValue, Compare, Alloc>& y) { return x.size() == y.size() && ft::equal(x.begin(), x.end(), y.begin()); }
+	template <typename Key, typename Val, typename KeyOfValue, typename Compare, typename Alloc, typename Cache, typename Balance>
+	inline bool	operator==(const Rb_tree<Key, Val, KeyOfValue, Compare, Alloc, Cache, Balance>& x, const Rb_tree<Key, Val, KeyOfValue, Compare, Alloc, Cache, Balance>& y) { return x.size() == y.size() && ft::equal(x.begin(), x.end(), y.begin()); }
 
-	template <typename Key, typename Val, typename KeyOfValue, typename Compare, typename Alloc>
-	inline bool	operator<(const Rb_tree<Key, Val, KeyOfValue, Compare, Alloc>& x, const Rb_tree<Key, Val, KeyOfValue, Compare, Alloc>& y) { return ft::lexicographical_compare(x.begin(), x.end(), y.begin(), y.end()); }
+	template <typename Key, typename Val, typename KeyOfValue, typename Compare, typename Alloc, typename Cache, typename Balance>
+	inline bool	operator<(const Rb_tree<Key, Val, KeyOfValue, Compare, Alloc, Cache, Balance>& x, const Rb_tree<Key, Val, KeyOfValue, Compare, Alloc, Cache, Balance>& y) { return ft::lexicographical_compare(x.begin(), x.end(), y.begin(), y.end()); }
 
-	template <typename Key, typename Val, typename KeyOfValue, typename Compare, typename Alloc>
-	inline bool	operator!=(const Rb_tree<Key, Val, KeyOfValue, Compare, Alloc>& x, const Rb_tree<Key, Val, KeyOfValue, Compare, Alloc>& y) { return !(x == y); }
+	template <typename Key, typename Val, typename KeyOfValue, typename Compare, typename Alloc, typename Cache, typename Balance>
+	inline bool	operator!=(const Rb_tree<Key, Val, KeyOfValue, Compare, Alloc, Cache, Balance>& x, const Rb_tree<Key, Val, KeyOfValue, Compare, Alloc, Cache, Balance>& y) { return !(x == y); }
 
-	template <typename Key, typename Val, typename KeyOfValue, typename Compare, typename Alloc>
-	inline bool	operator>(const Rb_tree<Key, Val, KeyOfValue, Compare, Alloc>& x, const Rb_tree<Key, Val, KeyOfValue, Compare, Alloc>& y) { return y < x; }
+	template <typename Key, typename Val, typename KeyOfValue, typename Compare, typename Alloc, typename Cache, typename Balance>
+	inline bool	operator>(const Rb_tree<Key, Val, KeyOfValue, Compare, Alloc, Cache, Balance>& x, const Rb_tree<Key, Val, KeyOfValue, Compare, Alloc, Cache, Balance>& y) { return y < x; }
 
-	template <typename Key, typename Val, typename KeyOfValue, typename Compare, typename Alloc>
-	inline bool	operator<=(const Rb_tree<Key, Val, KeyOfValue, Compare, Alloc>& x, const Rb_tree<Key, Val, KeyOfValue, Compare, Alloc>& y) { return !(y < x); }
+	template <typename Key, typename Val, typename KeyOfValue, typename Compare, typename Alloc, typename Cache, typename Balance>
+	inline bool	operator<=(const Rb_tree<Key, Val, KeyOfValue, Compare, Alloc, Cache, Balance>& x, const Rb_tree<Key, Val, KeyOfValue, Compare, Alloc, Cache, Balance>& y) { return !(y < x); }
 
-	template <typename Key, typename Val, typename KeyOfValue, typename Compare, typename Alloc>
-	inline bool	operator>=(const Rb_tree<Key, Val, KeyOfValue, Compare, Alloc>& x, const Rb_tree<Key, Val, KeyOfValue, Compare, Alloc>& y) { return !(x < y); }
+	template <typename Key, typename Val, typename KeyOfValue, typename Compare, typename Alloc, typename Cache, typename Balance>
+	inline bool	operator>=(const Rb_tree<Key, Val, KeyOfValue, Compare, Alloc, Cache, Balance>& x, const Rb_tree<Key, Val, KeyOfValue, Compare, Alloc, Cache, Balance>& y) { return !(x < y); }
 
 }//namespace
 
@@ -2,8 +2,29 @@
 # ifndef UTILITY_HPP
 # define UTILITY_HPP
 
+// Read prefetch hint, nothing where the builtin is missing.
+# if defined(__GNUC__)
+#  define FT_PREFETCH(p) __builtin_prefetch(p)
+# else
+#  define FT_PREFETCH(p) ((void)0)
+# endif
+
+// constexpr from C++14 on, where constexpr functions may assign.
+# if __cplusplus >= 201402L
+#  define FT_CONSTEXPR constexpr
+# else
+#  define FT_CONSTEXPR
+# endif
+
+# if __cplusplus >= 201103L
+#  include <utility>
+# endif
+
 namespace ft {
 
+	// Tag of the pair constructor building second in place.
+	struct	emplace_second_t {};
+
 	template <typename T1, typename T2>
 	struct pair {
 		typedef T1	first_type;
@@ -11,15 +32,26 @@ namespace ft {
 
 		T1	first;
 		T2	second;
-		pair() : first(T1()), second(T2()) {};
-		pair(const T1& x, const T2& y) : first(x), second(y) {};
+		FT_CONSTEXPR pair() : first(T1()), second(T2()) {};
+		FT_CONSTEXPR pair(const T1& x, const T2& y) : first(x), second(y) {};
+		// Declared since operator= is: C++11 deprecates the implicit one.
+		FT_CONSTEXPR pair(const pair& p) : first(p.first), second(p.second) {};
 		template<typename U, typename V>
-		pair(const pair<U, V>& p) : first(p.first), second(p.second) {};
-		pair	&operator=(const pair &pr) {
-			if (this != &pr) {
-				first = pr.first;
-				second = pr.second;
-			}
+		FT_CONSTEXPR pair(const pair<U, V>& p) : first(p.first), second(p.second) {};
+		// first copied from x, second direct-initialized from the rest.
+# if __cplusplus >= 201103L
+		template <typename... Args>
+		FT_CONSTEXPR pair(const T1& x, emplace_second_t, Args&&... args) : first(x), second(std::forward<Args>(args)...) {};
+# else
+		pair(const T1& x, emplace_second_t) : first(x), second() {};
+		template <typename A>
+		pair(const T1& x, emplace_second_t, const A& a) : first(x), second(a) {};
+# endif
+		// No self-assignment test: comparing the addresses of two distinct
+		// objects is not a constant expression.
+		FT_CONSTEXPR pair	&operator=(const pair &pr) {
+			first = pr.first;
+			second = pr.second;
 			return *this;
 		}
 	};